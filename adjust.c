@@ -0,0 +1,261 @@
+//
+// adjust.c
+// color adjustments, as a table over the colors of a sheet
+//
+// Sheets rarely have more than a few hundred distinct colors, so instead of
+// adjusting every pixel, the distinct colors are collected once, and an
+// adjustment only computes what each of them becomes. The table is then
+// either looked up by a shader, to preview the adjustment, or applied to the
+// pixels. Both copy the same bytes, so the result matches the preview
+// exactly, as long as the colors looked up are the ones collected: where
+// layers blend into new colors, they don't. Transparent pixels are left
+// alone, and so is alpha.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "color.h"
+#include "adjust.h"
+
+#define EMPTY 0xffffffff // Free slot of the set, never a 24-bit color
+
+static inline uint32_t colorKey(struct rgba c)
+{
+	return (uint32_t)c.r << 16 | (uint32_t)c.g << 8 | c.b;
+}
+
+static inline int clamp(int v, int lo, int hi)
+{
+	return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static inline float clampf(float v)
+{
+	return v < 0 ? 0 : (v > 1 ? 1 : v);
+}
+
+bool adjustIdentity(const struct adjustment *a)
+{
+	return !a->shift && !a->hue && !a->saturation && !a->lightness && a->low == 0 && a->high == 255;
+}
+
+//
+// Move parameter `p` by `delta`, keeping the levels at least one apart.
+//
+void adjustStep(struct adjustment *a, enum adjustparam p, int delta)
+{
+	switch (p) {
+	case ADJUST_SHIFT:      a->shift += delta;                                     break;
+	case ADJUST_HUE:        a->hue = ((a->hue + delta) % 360 + 360) % 360;         break;
+	case ADJUST_SATURATION: a->saturation = clamp(a->saturation + delta, -100, 100); break;
+	case ADJUST_LIGHTNESS:  a->lightness = clamp(a->lightness + delta, -100, 100);   break;
+	case ADJUST_LOW:        a->low = clamp(a->low + delta, 0, a->high - 1);        break;
+	case ADJUST_HIGH:       a->high = clamp(a->high + delta, a->low + 1, 255);     break;
+	}
+}
+
+//
+// What color `c` becomes, given the palette `colors` of `n` entries: palette
+// colors are rotated first, then hue, saturation and lightness are moved,
+// then the levels are stretched. The alpha of `c` is kept.
+//
+struct rgba adjustColor(const struct adjustment *a, const struct rgba *colors, int n, struct rgba c)
+{
+	int shift = n ? (a->shift % n + n) % n : 0;
+
+	for (int i = 0; shift && i < n; i++) {
+		if (colorKey(colors[i]) == colorKey(c)) {
+			struct rgba p = colors[(i + shift) % n];
+
+			c = (struct rgba){p.r, p.g, p.b, c.a};
+			break;
+		}
+	}
+	if (a->hue || a->saturation || a->lightness) {
+		struct hsla hsla = rgba2hsla(c);
+
+		hsla.h += a->hue / 360.0;
+		hsla.h -= hsla.h >= 1;
+		hsla.s  = clampf(hsla.s + a->saturation / 100.0);
+		hsla.l  = clampf(hsla.l + a->lightness / 100.0);
+
+		struct rgba d = hsla2rgba(hsla);
+
+		c = (struct rgba){d.r, d.g, d.b, c.a};
+	}
+	if (a->low > 0 || a->high < 255) {
+		uint8_t *ch[] = {&c.r, &c.g, &c.b};
+		int     d     = a->high - a->low;
+
+		for (int i = 0; i < 3; i++)
+			*ch[i] = clamp(((*ch[i] - a->low) * 255 + d / 2) / d, 0, 255);
+	}
+	return c;
+}
+
+struct colormap *colormapNew(void)
+{
+	struct colormap *m = calloc(1, sizeof(*m));
+
+	m->cap  = 1024;
+	m->keys = malloc(m->cap * sizeof(*m->keys));
+	m->last = EMPTY;
+	memset(m->keys, 0xff, m->cap * sizeof(*m->keys));
+
+	return m;
+}
+
+static void colormapInsert(struct colormap *m, uint32_t k)
+{
+	uint32_t i = (k * 2654435761u) & (m->cap - 1);
+
+	while (m->keys[i] != EMPTY && m->keys[i] != k)
+		i = (i + 1) & (m->cap - 1);
+
+	if (m->keys[i] == EMPTY) {
+		m->keys[i] = k;
+		m->n++;
+	}
+}
+
+//
+// Add the colors of `n` pixels to the set. Returns false once the set has
+// COLORMAP_MAX colors, after which others are ignored.
+//
+bool colormapAdd(struct colormap *m, const struct rgba *pixels, int n)
+{
+	for (int i = 0; i < n; i++) {
+		uint32_t k = colorKey(pixels[i]);
+
+		if (!pixels[i].a)
+			continue;
+		if (pixels[i].a < 255)
+			m->partial = true;
+		if (k == m->last) // Runs of a color are common
+			continue;
+		if (m->n == COLORMAP_MAX)
+			return false;
+
+		m->last = k;
+
+		if (m->n * 2 >= m->cap) {
+			uint32_t *old = m->keys;
+			int      cap  = m->cap;
+
+			m->cap *= 2;
+			m->n    = 0;
+			m->keys = malloc(m->cap * sizeof(*m->keys));
+			memset(m->keys, 0xff, m->cap * sizeof(*m->keys));
+
+			for (int j = 0; j < cap; j++) {
+				if (old[j] != EMPTY)
+					colormapInsert(m, old[j]);
+			}
+			free(old);
+		}
+		colormapInsert(m, k);
+	}
+	return true;
+}
+
+static int keyCompare(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+//
+// Turn the set into a sorted table, once all the colors are added. Values
+// start out as the colors themselves.
+//
+void colormapSort(struct colormap *m)
+{
+	int n = 0;
+
+	for (int i = 0; i < m->cap; i++) {
+		if (m->keys[i] != EMPTY)
+			m->keys[n++] = m->keys[i];
+	}
+	qsort(m->keys, n, sizeof(*m->keys), keyCompare);
+
+	m->cap    = 0;
+	m->values = malloc((n ? n : 1) * sizeof(*m->values));
+
+	for (int i = 0; i < n; i++) {
+		uint32_t k = m->keys[i];
+
+		m->values[i] = (struct rgba){k >> 16, k >> 8 & 0xff, k & 0xff, 255};
+	}
+}
+
+//
+// Compute what every color of the table becomes under `a`. The cost is in
+// the number of colors, not of pixels.
+//
+void colormapBuild(struct colormap *m, const struct adjustment *a, const struct rgba *colors, int n)
+{
+	for (int i = 0; i < m->n; i++) {
+		uint32_t    k = m->keys[i];
+		struct rgba c = {k >> 16, k >> 8 & 0xff, k & 0xff, 255};
+
+		m->values[i] = adjustIdentity(a) ? c : adjustColor(a, colors, n, c);
+	}
+}
+
+//
+// Index of the color of `c` in the sorted table, or -1.
+//
+int colormapFind(const struct colormap *m, struct rgba c)
+{
+	uint32_t k = colorKey(c);
+	int lo = 0, hi = m->n;
+
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+
+		if (m->keys[mid] < k)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo < m->n && m->keys[lo] == k ? lo : -1;
+}
+
+//
+// Replace the colors of `n` pixels by what the table maps them to, keeping
+// their alpha. Does what the preview shader does, byte for byte.
+//
+void colormapApply(const struct colormap *m, struct rgba *pixels, int n)
+{
+	uint32_t last = EMPTY;
+	int      i    = -1;
+
+	for (int p = 0; p < n; p++) {
+		struct rgba *c = &pixels[p];
+
+		if (!c->a)
+			continue;
+		if (colorKey(*c) != last) { // Runs of a color are common
+			last = colorKey(*c);
+			i    = colormapFind(m, *c);
+		}
+		if (i >= 0) {
+			c->r = m->values[i].r;
+			c->g = m->values[i].g;
+			c->b = m->values[i].b;
+		}
+	}
+}
+
+void colormapFree(struct colormap *m)
+{
+	if (!m)
+		return;
+
+	free(m->keys);
+	free(m->values);
+	free(m);
+}
@@ -0,0 +1,42 @@
+//
+// adjust.h
+// color adjustments, as a table over the colors of a sheet
+//
+#define COLORMAP_MAX 65536 // Distinct colors adjusted, at most
+
+enum adjustparam {
+	ADJUST_SHIFT,
+	ADJUST_HUE,
+	ADJUST_SATURATION,
+	ADJUST_LIGHTNESS,
+	ADJUST_LOW,
+	ADJUST_HIGH
+};
+
+struct adjustment {
+	int shift;      // Palette entries to rotate the palette's colors by
+	int hue;        // Degrees, from 0 to 359
+	int saturation; // Percent, added
+	int lightness;  // Percent, added
+	int low, high;  // Input levels that become 0 and 255
+};
+
+struct colormap {
+	uint32_t    *keys;   // Distinct colors, as 0xRRGGBB, sorted once collected
+	struct rgba *values; // What each color becomes
+	int         n;
+	int         cap;     // Slots of the set, while collecting
+	uint32_t    last;    // Last color added
+	bool        partial; // Some color was added partly transparent
+};
+
+bool             adjustIdentity(const struct adjustment *);
+void             adjustStep(struct adjustment *, enum adjustparam, int);
+struct rgba      adjustColor(const struct adjustment *, const struct rgba *, int, struct rgba);
+struct colormap *colormapNew(void);
+bool             colormapAdd(struct colormap *, const struct rgba *, int);
+void             colormapSort(struct colormap *);
+void             colormapBuild(struct colormap *, const struct adjustment *, const struct rgba *, int);
+int              colormapFind(const struct colormap *, struct rgba);
+void             colormapApply(const struct colormap *, struct rgba *, int);
+void             colormapFree(struct colormap *);
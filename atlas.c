@@ -0,0 +1,452 @@
+//
+// atlas.c
+// sprite sheet atlas packing
+//
+// Frames are trimmed to the bounds of their visible pixels, frames that
+// trim to the same pixels are stored once, and the rest are packed into the
+// smallest power-of-two image that holds them with the MaxRects algorithm:
+// the free space is kept as a list of maximal rectangles, which may overlap,
+// and each frame goes where it leaves the least space on its shorter side.
+// Frames are placed largest first, which packs tighter and keeps the list
+// short, and only the rectangles touched by a placement are compared when
+// pruning it, so thousands of frames pack in a fraction of a second.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "color.h"
+#include "atlas.h"
+
+#define ATLAS_MAX 16384
+
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+struct box {
+	int x, y, w, h;
+};
+
+struct packer {
+	struct box *free, *fresh;
+	int        nfree, nfresh;
+	int        cap;
+};
+
+static inline bool contains(struct box a, struct box b)
+{
+	return b.x >= a.x && b.y >= a.y && b.x + b.w <= a.x + a.w && b.y + b.h <= a.y + a.h;
+}
+
+static inline bool overlaps(struct box a, struct box b)
+{
+	return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static void packerPush(struct packer *p, struct box b)
+{
+	if (p->nfree + p->nfresh == p->cap) {
+		p->cap  *= 2;
+		p->free  = realloc(p->free, p->cap * sizeof(*p->free));
+		p->fresh = realloc(p->fresh, p->cap * sizeof(*p->fresh));
+	}
+	p->fresh[p->nfresh++] = b;
+}
+
+//
+// Find where a `w * h` rectangle fits best. Returns false if it doesn't.
+//
+static bool packerFind(struct packer *p, int w, int h, struct box *out)
+{
+	int best = INT32_MAX, bestLong = INT32_MAX;
+
+	for (int i = 0; i < p->nfree; i++) {
+		struct box f = p->free[i];
+
+		if (f.w < w || f.h < h)
+			continue;
+
+		int dw = f.w - w, dh = f.h - h,
+		    s  = min(dw, dh), l = max(dw, dh);
+
+		if (s < best || (s == best && l < bestLong)) {
+			*out     = (struct box){ f.x, f.y, w, h };
+			best     = s;
+			bestLong = l;
+		}
+	}
+	return best != INT32_MAX;
+}
+
+//
+// Take `used` out of the free space. Free rectangles it overlaps are
+// replaced by the parts of them around it, and rectangles inside others
+// are dropped.
+//
+static void packerSplit(struct packer *p, struct box u)
+{
+	int n = 0;
+
+	p->nfresh = 0;
+
+	for (int i = 0; i < p->nfree; i++) {
+		struct box f = p->free[i];
+
+		if (!overlaps(f, u)) {
+			p->free[n++] = f;
+			continue;
+		}
+		if (u.x > f.x)
+			packerPush(p, (struct box){ f.x, f.y, u.x - f.x, f.h });
+		if (u.x + u.w < f.x + f.w)
+			packerPush(p, (struct box){ u.x + u.w, f.y, f.x + f.w - u.x - u.w, f.h });
+		if (u.y > f.y)
+			packerPush(p, (struct box){ f.x, f.y, f.w, u.y - f.y });
+		if (u.y + u.h < f.y + f.h)
+			packerPush(p, (struct box){ f.x, u.y + u.h, f.w, f.y + f.h - u.y - u.h });
+	}
+	p->nfree = n;
+
+	// The rectangles left untouched don't contain each other, so only the
+	// new ones need comparing.
+	for (int i = 0; i < p->nfresh; i++) {
+		struct box b = p->fresh[i];
+		bool inside = false;
+
+		for (int j = 0; j < p->nfresh && !inside; j++) {
+			inside = j != i && contains(p->fresh[j], b) && (j < i || !contains(b, p->fresh[j]));
+		}
+		for (int j = 0; j < n && !inside; j++) {
+			inside = contains(p->free[j], b);
+		}
+		if (inside)
+			continue;
+
+		for (int j = 0; j < n; j++) {
+			if (contains(b, p->free[j]))
+				p->free[j--] = p->free[--n];
+		}
+		p->free[n++] = b;
+	}
+	p->nfree = n;
+}
+
+struct order {
+	const int *w, *h;
+};
+
+static struct order sorting;
+
+static int compareSize(const void *a, const void *b)
+{
+	int i = *(const int *)a, j = *(const int *)b,
+	    si = max(sorting.w[i], sorting.h[i]),
+	    sj = max(sorting.w[j], sorting.h[j]);
+
+	if (si != sj)
+		return sj - si;
+	if (sorting.w[i] * sorting.h[i] != sorting.w[j] * sorting.h[j])
+		return sorting.w[j] * sorting.h[j] - sorting.w[i] * sorting.h[i];
+
+	return i - j;
+}
+
+//
+// Pack `n` rectangles of `w[i] * h[i]` into a `aw * ah` area, storing
+// their positions in `x` and `y`. Returns false if they don't fit.
+//
+static bool packInto(const int *w, const int *h, const int *order, int n, int aw, int ah, int *x, int *y)
+{
+	struct packer p = {
+		.free  = malloc(64 * sizeof(struct box)),
+		.fresh = malloc(64 * sizeof(struct box)),
+		.nfree = 1,
+		.cap   = 64
+	};
+	bool ok = true;
+
+	p.free[0] = (struct box){ 0, 0, aw, ah };
+
+	for (int k = 0; k < n && ok; k++) {
+		int i = order[k];
+		struct box b;
+
+		if (!w[i] || !h[i])
+			continue;
+
+		if ((ok = packerFind(&p, w[i], h[i], &b))) {
+			x[i] = b.x;
+			y[i] = b.y;
+			packerSplit(&p, b);
+		}
+	}
+	free(p.free);
+	free(p.fresh);
+
+	return ok;
+}
+
+//
+// Pack `n` rectangles of `w[i] * h[i]`, which may be empty, into the
+// smallest power-of-two area that holds them, with `padding` pixels between
+// them. Rectangles are packed padded on the right and bottom into an area
+// that is `padding` larger, so that the padding past the last ones falls
+// outside the atlas. Their positions are stored in `pos`, `x` then `y`, and the size of
+// the area in `aw` and `ah`. Returns false if they need more than
+// ATLAS_MAX pixels on a side.
+//
+bool atlasPack(const int *w, const int *h, int n, int padding, int *pos, int *aw, int *ah)
+{
+	int *order = malloc(n * sizeof(*order)),
+	    *pw    = malloc(n * sizeof(*pw)),
+	    *ph    = malloc(n * sizeof(*ph));
+	size_t area = 0;
+	int side = 1;
+
+	for (int i = 0; i < n; i++) {
+		order[i] = i;
+		pw[i] = w[i] ? w[i] + padding : 0;
+		ph[i] = h[i] ? h[i] + padding : 0;
+		area += (size_t)pw[i] * ph[i];
+		side = max(side, max(w[i], h[i]));
+	}
+	sorting = (struct order){ pw, ph };
+	qsort(order, n, sizeof(*order), compareSize);
+
+	// Start from the smallest area that could hold everything, and grow the
+	// shorter side until it does.
+	*aw = *ah = 1;
+
+	while (*aw < side)
+		*aw *= 2;
+	while (*ah < side)
+		*ah *= 2;
+	while ((size_t)(*aw + padding) * (*ah + padding) < area) {
+		if (*aw <= *ah)
+			*aw *= 2;
+		else
+			*ah *= 2;
+	}
+	bool ok = false;
+
+	while (*aw <= ATLAS_MAX && *ah <= ATLAS_MAX && !(ok = packInto(pw, ph, order, n, *aw + padding, *ah + padding, pos, pos + n))) {
+		if (*aw <= *ah)
+			*aw *= 2;
+		else
+			*ah *= 2;
+	}
+	free(order);
+	free(pw);
+	free(ph);
+
+	return ok;
+}
+
+static uint64_t hashPixels(const struct rgba *pixels, int w, int h, int stride)
+{
+	uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+	for (int y = 0; y < h; y++) {
+		const uint32_t *row = (const uint32_t *)&pixels[y * stride];
+
+		for (int x = 0; x < w; x++) {
+			hash = (hash ^ row[x]) * UINT64_C(0x100000001b3);
+		}
+	}
+	return hash ^ (uint64_t)w << 32 ^ (uint64_t)h;
+}
+
+static bool samePixels(const struct rgba *a, const struct rgba *b, int w, int h, int stride)
+{
+	for (int y = 0; y < h; y++) {
+		if (memcmp(&a[y * stride], &b[y * stride], w * sizeof(*a)))
+			return false;
+	}
+	return true;
+}
+
+//
+// Trim the `fw * fh` frame at `pixels` to the bounds of its visible
+// pixels.
+//
+static void trim(const struct rgba *pixels, int fw, int fh, int stride, struct atlasframe *f)
+{
+	int x0 = fw, y0 = fh, x1 = 0, y1 = 0;
+
+	for (int y = 0; y < fh; y++) {
+		const struct rgba *row = &pixels[y * stride];
+
+		for (int x = 0; x < fw; x++) {
+			if (row[x].a) {
+				x0 = min(x0, x);
+				x1 = max(x1, x + 1);
+				y0 = min(y0, y);
+				y1 = y + 1;
+			}
+		}
+	}
+	f->ox = x1 ? x0 : 0;
+	f->oy = x1 ? y0 : 0;
+	f->w  = x1 ? x1 - x0 : 0;
+	f->h  = x1 ? y1 - y0 : 0;
+}
+
+//
+// Build an atlas of the `nframes` frames of `fw * fh` pixels in `sheet`,
+// laid out in a row, each shown for `duration` milliseconds. Returns NULL
+// if they don't fit in the largest atlas.
+//
+struct atlas *atlasBuild(const struct rgba *sheet, int fw, int fh, int nframes, int duration, int padding)
+{
+	int stride = fw * nframes,
+	    nbuckets = 1;
+
+	while (nbuckets < nframes * 2)
+		nbuckets *= 2;
+
+	struct atlas *a = malloc(sizeof(*a));
+	int *w = calloc(nframes, sizeof(*w)),
+	    *h = calloc(nframes, sizeof(*h)),
+	    *pos = malloc(2 * nframes * sizeof(*pos)),
+	    *buckets = malloc(nbuckets * sizeof(*buckets)),
+	    *next = malloc(nframes * sizeof(*next));
+
+	memset(buckets, -1, nbuckets * sizeof(*buckets));
+
+	a->fw      = fw;
+	a->fh      = fh;
+	a->frames  = calloc(nframes, sizeof(*a->frames));
+	a->nframes = nframes;
+	a->unique  = 0;
+	a->pixels  = NULL;
+
+	// Frames that trim to the same pixels share the first one's rectangle.
+	for (int i = 0; i < nframes; i++) {
+		struct atlasframe *f = &a->frames[i];
+
+		trim(&sheet[i * fw], fw, fh, stride, f);
+
+		f->source   = i;
+		f->duration = duration;
+
+		if (!f->w)
+			continue;
+
+		const struct rgba *px = &sheet[f->oy * stride + i * fw + f->ox];
+		uint64_t hash = hashPixels(px, f->w, f->h, stride);
+		int *b = &buckets[hash & (nbuckets - 1)];
+
+		for (int j = *b; j >= 0; j = next[j]) {
+			struct atlasframe *g = &a->frames[j];
+
+			if (g->w == f->w && g->h == f->h &&
+			    samePixels(px, &sheet[g->oy * stride + j * fw + g->ox], f->w, f->h, stride)) {
+				f->source = j;
+				break;
+			}
+		}
+		if (f->source != i)
+			continue;
+
+		next[i] = *b;
+		*b = i;
+		w[i] = f->w;
+		h[i] = f->h;
+		a->unique++;
+	}
+	free(buckets);
+	free(next);
+
+	if (!atlasPack(w, h, nframes, padding, pos, &a->w, &a->h)) {
+		free(w);
+		free(h);
+		free(pos);
+		atlasFree(a);
+		return NULL;
+	}
+	a->pixels = calloc((size_t)a->w * a->h, sizeof(*a->pixels));
+
+	for (int i = 0; i < nframes; i++) {
+		struct atlasframe *f = &a->frames[i];
+
+		if (!f->w)
+			continue;
+
+		f->x = pos[f->source];
+		f->y = pos[nframes + f->source];
+
+		if (f->source != i)
+			continue;
+
+		for (int y = 0; y < f->h; y++) {
+			memcpy(&a->pixels[(size_t)(f->y + y) * a->w + f->x],
+			       &sheet[(f->oy + y) * stride + i * fw + f->ox], f->w * sizeof(*a->pixels));
+		}
+	}
+	free(w);
+	free(h);
+	free(pos);
+
+	return a;
+}
+
+//
+// Write `s` as a JSON string.
+//
+static void writeString(FILE *fp, const char *s)
+{
+	fputc('"', fp);
+
+	for (; *s; s++) {
+		unsigned char c = *s;
+
+		if (c == '"' || c == '\\')
+			fprintf(fp, "\\%c", c);
+		else if (c < 0x20)
+			fprintf(fp, "\\u%04x", c);
+		else
+			fputc(c, fp);
+	}
+	fputc('"', fp);
+}
+
+//
+// Write the layout of the atlas as JSON to `path`, for the image at
+// `image`. Returns 0, or -1 with `errno` set.
+//
+int atlasWrite(const struct atlas *a, const char *image, const char *path)
+{
+	FILE *fp = fopen(path, "w");
+
+	if (!fp)
+		return -1;
+
+	fprintf(fp, "{\n\t\"image\": ");
+	writeString(fp, image);
+	fprintf(fp, ",\n");
+	fprintf(fp, "\t\"size\": {\"w\": %d, \"h\": %d},\n", a->w, a->h);
+	fprintf(fp, "\t\"frame\": {\"w\": %d, \"h\": %d},\n", a->fw, a->fh);
+	fprintf(fp, "\t\"frames\": [\n");
+
+	for (int i = 0; i < a->nframes; i++) {
+		const struct atlasframe *f = &a->frames[i];
+
+		fprintf(fp, "\t\t{\"x\": %d, \"y\": %d, \"w\": %d, \"h\": %d, \"ox\": %d, \"oy\": %d, \"source\": %d, \"duration\": %d}%s\n",
+			f->x, f->y, f->w, f->h, f->ox, f->oy, f->source, f->duration, i < a->nframes - 1 ? "," : "");
+	}
+	fprintf(fp, "\t]\n}\n");
+
+	return fclose(fp) ? -1 : 0;
+}
+
+void atlasFree(struct atlas *a)
+{
+	if (!a)
+		return;
+
+	free(a->pixels);
+	free(a->frames);
+	free(a);
+}
@@ -0,0 +1,25 @@
+//
+// atlas.h
+// sprite sheet atlas packing
+//
+struct atlasframe {
+	int x, y;     // Position in the atlas
+	int w, h;     // Size once trimmed, 0 if the frame is blank
+	int ox, oy;   // Position of the trimmed pixels in the frame
+	int source;   // Frame with the same pixels that was packed, or this one
+	int duration; // In milliseconds
+};
+
+struct atlas {
+	int               w, h; // Powers of two
+	int               fw, fh;
+	struct rgba       *pixels;
+	struct atlasframe *frames;
+	int               nframes;
+	int               unique; // Frames packed, after removing duplicates
+};
+
+bool          atlasPack(const int *, const int *, int, int, int *, int *, int *);
+struct atlas *atlasBuild(const struct rgba *, int, int, int, int, int);
+int           atlasWrite(const struct atlas *, const char *, const char *);
+void          atlasFree(struct atlas *);
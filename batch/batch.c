@@ -0,0 +1,752 @@
+//
+// batch.c
+// convert sprite sheets in bulk
+//
+// usage: px-batch -o <dir> [options] <file or directory>...
+//
+// Every TGA and PNG image under the given paths is decoded, optionally
+// cropped, transformed, remapped to a palette and split into frames, then
+// written under the output directory, at the same relative path.
+//
+// Files go through a pipeline of bounded queues: one thread reads files
+// into memory, a worker per core converts them, and one thread writes the
+// results. Reading, converting and writing overlap, and no more than a few
+// files per worker are held in memory at once.
+//
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+
+#include "color.h"
+#include "tga.h"
+#include "png.h"
+#include "transform.h"
+#include "palette.h"
+
+#define MAX_THREADS 64
+#define QUEUE_DEPTH 4 // Files in flight per worker, between each stage
+
+struct queue {
+	void            **items;
+	int             cap, head, len;
+	bool            closed;
+	pthread_mutex_t lock;
+	pthread_cond_t  readable, writable;
+};
+
+struct output {
+	char   *path;
+	char   *data;
+	size_t size;
+};
+
+struct job {
+	char          *path; // Input file
+	char          *rel;  // Its path under the directory it was found in
+	uint8_t       *data;
+	size_t        size;
+	struct output *outputs;
+	int           noutputs;
+	char          *error;
+};
+
+struct image {
+	int      w, h, depth;
+	uint32_t *pixels;
+	char     id[256];
+};
+
+static struct {
+	const char  *outdir;
+	const char  *format;    // Output extension, or NULL to keep the input's
+	bool        rle;
+	bool        crop;
+	int         cx, cy, cw, ch;
+	int         split;      // Frame width to split at, 0 for the sheet's, -1 not to
+	int         transform;  // Or -1
+	struct rgba *colors;    // Palette to remap to
+	int         ncolors;
+	bool        dither;
+	int         level;
+	int         threads;
+} opts = { .split = -1, .transform = -1, .level = 6 };
+
+static struct queue paths, loaded, converted;
+
+// Output path of every file queued, without a frame number, and the file
+static struct {
+	char **outputs, **inputs;
+	int  n, cap;  // Slots, a power of two
+} claims;
+
+static const struct {
+	const char     *name;
+	enum transform t;
+} transforms[] = {
+	{ "flip-h",     TRANSFORM_FLIP_H },
+	{ "flip-v",     TRANSFORM_FLIP_V },
+	{ "rotate-cw",  TRANSFORM_ROTATE_CW },
+	{ "rotate-ccw", TRANSFORM_ROTATE_CCW },
+	{ "scale2",     TRANSFORM_SCALE_2 },
+	{ "scale3",     TRANSFORM_SCALE_3 },
+	{ "scale2x",    TRANSFORM_SCALE2X },
+	{ "scale3x",    TRANSFORM_SCALE3X }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Queues
+///////////////////////////////////////////////////////////////////////////////
+
+static void queueInit(struct queue *q, int cap)
+{
+	q->items = malloc(cap * sizeof(*q->items));
+	q->cap   = cap;
+
+	pthread_mutex_init(&q->lock, NULL);
+	pthread_cond_init(&q->readable, NULL);
+	pthread_cond_init(&q->writable, NULL);
+}
+
+//
+// Add `item`, waiting for room if the queue is full.
+//
+static void queuePush(struct queue *q, void *item)
+{
+	pthread_mutex_lock(&q->lock);
+
+	while (q->len == q->cap)
+		pthread_cond_wait(&q->writable, &q->lock);
+
+	q->items[(q->head + q->len++) % q->cap] = item;
+
+	pthread_cond_signal(&q->readable);
+	pthread_mutex_unlock(&q->lock);
+}
+
+//
+// Remove the oldest item, waiting for one if the queue is empty. Returns
+// NULL once the queue is closed and empty.
+//
+static void *queuePop(struct queue *q)
+{
+	void *item = NULL;
+
+	pthread_mutex_lock(&q->lock);
+
+	while (q->len == 0 && !q->closed)
+		pthread_cond_wait(&q->readable, &q->lock);
+
+	if (q->len) {
+		item = q->items[q->head];
+		q->head = (q->head + 1) % q->cap;
+		q->len--;
+		pthread_cond_signal(&q->writable);
+	}
+	pthread_mutex_unlock(&q->lock);
+
+	return item;
+}
+
+static void queueClose(struct queue *q)
+{
+	pthread_mutex_lock(&q->lock);
+	q->closed = true;
+	pthread_cond_broadcast(&q->readable);
+	pthread_mutex_unlock(&q->lock);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Conversion
+///////////////////////////////////////////////////////////////////////////////
+
+static bool pathIsPNG(const char *path)
+{
+	const char *ext = strrchr(path, '.');
+
+	return ext && !strcasecmp(ext, ".png");
+}
+
+static bool pathIsImage(const char *path)
+{
+	const char *ext = strrchr(path, '.');
+
+	return ext && (!strcasecmp(ext, ".png") || !strcasecmp(ext, ".tga"));
+}
+
+static bool decode(struct job *j, struct image *img)
+{
+	if (pathIsPNG(j->path)) {
+		struct png *p = pngRead(j->data, j->size);
+
+		if (!p)
+			return false;
+
+		*img = (struct image){ .w = p->width, .h = p->height, .depth = p->depth, .pixels = p->data };
+		memcpy(img->id, p->id, sizeof(img->id));
+		free(p);
+
+		return true;
+	}
+	FILE *fp = j->size ? fmemopen(j->data, j->size, "rb") : NULL;
+	struct tga *t = fp ? tgaRead(fp) : NULL;
+
+	if (fp)
+		fclose(fp);
+	if (!t)
+		return false;
+
+	*img = (struct image){ .w = t->width, .h = t->height, .depth = t->depth, .pixels = t->data };
+	memcpy(img->id, t->id, sizeof(img->id));
+	free(t);
+
+	return true;
+}
+
+//
+// Encode `img` in memory as the output `path`.
+//
+static bool encode(struct output *o, struct image *img, const char *path)
+{
+	FILE *fp = open_memstream(&o->data, &o->size);
+	int err;
+
+	o->path = strdup(path);
+
+	if (!fp)
+		return false;
+
+	if (pathIsPNG(path)) {
+		err = pngWrite(fp, img->pixels, img->w, img->h, opts.level, img->id);
+	} else if (img->w > SHRT_MAX || img->h > SHRT_MAX) {
+		err = 1;
+		errno = EFBIG;
+	} else {
+		err = tgaWrite(fp, img->pixels, img->w, img->h, img->depth, img->id, opts.rle);
+	}
+	return fclose(fp) == 0 && !err;
+}
+
+static void fail(struct job *j, const char *fmt, ...)
+{
+	char msg[256];
+	va_list ap;
+
+	va_start(ap, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, ap);
+	va_end(ap);
+
+	j->error = strdup(msg);
+}
+
+//
+// Return the output path for `rel`, with the output format's extension, and
+// the frame number if `frame` isn't negative.
+//
+static char *outputPath(const char *rel, const char *inpath, int frame)
+{
+	const char *ext = opts.format ? opts.format : pathIsPNG(inpath) ? ".png" : ".tga",
+	           *dot = strrchr(rel, '.'), *slash = strrchr(rel, '/');
+	int stem = dot && (!slash || dot > slash) ? (int)(dot - rel) : (int)strlen(rel);
+	char *path = malloc(strlen(opts.outdir) + strlen(rel) + 32);
+
+	if (frame >= 0)
+		sprintf(path, "%s/%.*s-%d%s", opts.outdir, stem, rel, frame, ext);
+	else
+		sprintf(path, "%s/%.*s%s", opts.outdir, stem, rel, ext);
+
+	return path;
+}
+
+static uint32_t hashString(const char *s)
+{
+	uint32_t h = 2166136261u;
+
+	for (; *s; s++)
+		h = (h ^ (uint8_t)*s) * 16777619u;
+
+	return h;
+}
+
+//
+// Claim the outputs of the input `path` at `rel`. Frame numbers are only
+// digits, so two inputs write the same files exactly when their outputs
+// without a frame number are the same. Returns the input that claimed them
+// first, or NULL.
+//
+static const char *outputClaim(const char *path, const char *rel)
+{
+	if (claims.n * 2 >= claims.cap) {
+		char **outputs = claims.outputs, **inputs = claims.inputs;
+		int  cap       = claims.cap;
+
+		claims.cap     = cap ? cap * 2 : 1024;
+		claims.outputs = calloc(claims.cap, sizeof(*claims.outputs));
+		claims.inputs  = calloc(claims.cap, sizeof(*claims.inputs));
+
+		for (int i = 0; i < cap; i++) {
+			if (!outputs[i])
+				continue;
+
+			uint32_t k = hashString(outputs[i]) & (claims.cap - 1);
+
+			while (claims.outputs[k])
+				k = (k + 1) & (claims.cap - 1);
+
+			claims.outputs[k] = outputs[i];
+			claims.inputs[k]  = inputs[i];
+		}
+		free(outputs);
+		free(inputs);
+	}
+	char     *out = outputPath(rel, path, -1);
+	uint32_t k    = hashString(out) & (claims.cap - 1);
+
+	for (; claims.outputs[k]; k = (k + 1) & (claims.cap - 1)) {
+		if (!strcmp(claims.outputs[k], out)) {
+			free(out);
+			return claims.inputs[k];
+		}
+	}
+	claims.outputs[k] = out;
+	claims.inputs[k]  = strdup(path);
+	claims.n++;
+
+	return NULL;
+}
+
+static void convert(struct job *j, struct nearest *nearest)
+{
+	struct image img;
+	bool keepid = true; // Whether px's sheet description still applies
+
+	if (!decode(j, &img)) {
+		fail(j, "not a valid %s image", pathIsPNG(j->path) ? "PNG" : "TGA");
+		return;
+	}
+	if (opts.crop) {
+		int x0 = opts.cx < 0 ? 0 : opts.cx, y0 = opts.cy < 0 ? 0 : opts.cy,
+		    x1 = opts.cx + opts.cw > img.w ? img.w : opts.cx + opts.cw,
+		    y1 = opts.cy + opts.ch > img.h ? img.h : opts.cy + opts.ch;
+
+		if (x1 <= x0 || y1 <= y0) {
+			fail(j, "crop is outside the %dx%d image", img.w, img.h);
+			goto done;
+		}
+		uint32_t *out = malloc((size_t)(x1 - x0) * (y1 - y0) * sizeof(*out));
+
+		for (int y = y0; y < y1; y++) {
+			memcpy(&out[(y - y0) * (x1 - x0)], &img.pixels[y * img.w + x0], (x1 - x0) * sizeof(*out));
+		}
+		free(img.pixels);
+		img.pixels = out;
+		img.w = x1 - x0;
+		img.h = y1 - y0;
+		keepid = false;
+	}
+	if (opts.transform >= 0) {
+		int ow, oh;
+
+		transformSize(opts.transform, img.w, img.h, &ow, &oh);
+
+		uint32_t *out = malloc((size_t)ow * oh * sizeof(*out));
+
+		transformPixels(opts.transform, (struct rgba *)img.pixels, img.w, img.h, (struct rgba *)out);
+		free(img.pixels);
+		img.pixels = out;
+		img.w = ow;
+		img.h = oh;
+		keepid = keepid && (opts.transform == TRANSFORM_FLIP_H || opts.transform == TRANSFORM_FLIP_V);
+	}
+	if (!keepid)
+		img.id[0] = '\0';
+
+	if (nearest)
+		nearestRemap(nearest, (struct rgba *)img.pixels, img.w, img.h, opts.dither);
+
+	if (opts.split < 0) {
+		char *path = outputPath(j->rel, j->path, -1);
+
+		j->outputs = calloc(1, sizeof(*j->outputs));
+		j->noutputs = 1;
+
+		if (!encode(&j->outputs[0], &img, path))
+			fail(j, "couldn't encode: %s", strerror(errno));
+
+		free(path);
+		goto done;
+	}
+	int fw = opts.split, n;
+
+	// Sheets saved by px record their frame width, and otherwise have
+	// square frames.
+	if (fw == 0 && (!keepid || sscanf(img.id, "px %d", &fw) != 1))
+		fw = img.h;
+
+	if (fw <= 0 || img.w % fw) {
+		fail(j, "width %d isn't a multiple of the frame width %d", img.w, fw);
+		goto done;
+	}
+	n = img.w / fw;
+	j->outputs  = calloc(n, sizeof(*j->outputs));
+	j->noutputs = n;
+
+	struct image frame = { .w = fw, .h = img.h, .depth = img.depth, .pixels = malloc((size_t)fw * img.h * sizeof(*img.pixels)) };
+
+	memcpy(frame.id, img.id, sizeof(frame.id));
+
+	for (int f = 0; f < n && !j->error; f++) {
+		char *path = outputPath(j->rel, j->path, f);
+
+		for (int y = 0; y < img.h; y++) {
+			memcpy(&frame.pixels[y * fw], &img.pixels[y * img.w + f * fw], fw * sizeof(*frame.pixels));
+		}
+		if (!encode(&j->outputs[f], &frame, path))
+			fail(j, "couldn't encode frame %d: %s", f, strerror(errno));
+
+		free(path);
+	}
+	free(frame.pixels);
+done:
+	free(img.pixels);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pipeline stages
+///////////////////////////////////////////////////////////////////////////////
+
+static void *reader(void *_)
+{
+	struct job *j;
+
+	while ((j = queuePop(&paths))) {
+		if (j->error) {
+			queuePush(&loaded, j);
+			continue;
+		}
+		errno = 0;
+
+		FILE *fp = fopen(j->path, "rb");
+		long size = -1;
+
+		if (fp && fseek(fp, 0, SEEK_END) == 0 && (size = ftell(fp)) >= 0 && fseek(fp, 0, SEEK_SET) == 0) {
+			j->data = malloc(size ? size : 1);
+			j->size = fread(j->data, 1, size, fp);
+		}
+		if (!fp || size < 0 || j->size != (size_t)size)
+			fail(j, "couldn't read: %s", strerror(errno ? errno : EIO));
+		if (fp)
+			fclose(fp);
+
+		queuePush(&loaded, j);
+	}
+	queueClose(&loaded);
+
+	return NULL;
+}
+
+static void *worker(void *_)
+{
+	struct nearest *nearest = opts.colors ? nearestBuild(opts.colors, opts.ncolors) : NULL;
+	struct job *j;
+
+	while ((j = queuePop(&loaded))) {
+		if (!j->error)
+			convert(j, nearest);
+
+		free(j->data);
+		j->data = NULL;
+
+		queuePush(&converted, j);
+	}
+	nearestFree(nearest);
+
+	return NULL;
+}
+
+//
+// Create the directories leading to `path`.
+//
+static int makeParents(const char *path)
+{
+	char *dir = strdup(path);
+	int err = 0;
+
+	for (char *p = dir + 1; *p && !err; p++) {
+		if (*p != '/')
+			continue;
+
+		*p = '\0';
+		if (mkdir(dir, 0777) != 0 && errno != EEXIST)
+			err = errno;
+		*p = '/';
+	}
+	free(dir);
+
+	return err;
+}
+
+struct report {
+	long   files, failed;
+	double read, written; // Bytes
+	char   **errors;
+};
+
+static void *writer(void *arg)
+{
+	struct report *r = arg;
+	struct job *j;
+
+	while ((j = queuePop(&converted))) {
+		for (int i = 0; i < j->noutputs && !j->error; i++) {
+			struct output *o = &j->outputs[i];
+			int err = makeParents(o->path);
+			FILE *fp = err ? NULL : fopen(o->path, "wb");
+
+			if (fp && fwrite(o->data, 1, o->size, fp) == o->size && fclose(fp) == 0)
+				r->written += o->size;
+			else
+				fail(j, "couldn't write '%s': %s", o->path, strerror(err ? err : errno));
+		}
+		if (j->error) {
+			char *line = malloc(strlen(j->path) + strlen(j->error) + 3);
+
+			sprintf(line, "%s: %s", j->path, j->error);
+			r->errors = realloc(r->errors, (r->failed + 1) * sizeof(*r->errors));
+			r->errors[r->failed++] = line;
+		} else {
+			r->files++;
+			r->read += j->size;
+		}
+		for (int i = 0; i < j->noutputs; i++) {
+			free(j->outputs[i].path);
+			free(j->outputs[i].data);
+		}
+		free(j->outputs);
+		free(j->error);
+		free(j->path);
+		free(j->rel);
+		free(j);
+	}
+	return NULL;
+}
+
+//
+// Queue the image files under `path`. `rel` is the part of `path` below the
+// directory given on the command line.
+//
+static void walk(const char *path, const char *rel, bool top)
+{
+	struct stat st;
+
+	// Symbolic links are only followed when given on the command line, so
+	// that links back up the tree don't loop.
+	bool found = (top ? stat : lstat)(path, &st) == 0;
+
+	if (!found || !S_ISDIR(st.st_mode)) {
+		// Files named on the command line are converted whatever their name.
+		// Images that can't be looked at are queued, and fail with the reason.
+		if (!top && ((found && !S_ISREG(st.st_mode)) || !pathIsImage(path)))
+			return;
+
+		struct job *j = calloc(1, sizeof(*j));
+
+		j->path = strdup(path);
+		j->rel  = strdup(rel);
+
+		const char *other;
+
+		if (stat(path, &st) != 0)
+			fail(j, "%s", strerror(errno));
+		else if ((other = outputClaim(path, rel)))
+			fail(j, "would overwrite the output of '%s'", other);
+
+		queuePush(&paths, j);
+		return;
+	}
+	DIR *d = opendir(path);
+	struct dirent *e;
+
+	if (!d) {
+		fprintf(stderr, "px-batch: couldn't open '%s': %s\n", path, strerror(errno));
+		return;
+	}
+	while ((e = readdir(d))) {
+		if (e->d_name[0] == '.')
+			continue;
+
+		char *sub    = malloc(strlen(path) + strlen(e->d_name) + 2),
+		     *subrel = malloc(strlen(rel) + strlen(e->d_name) + 2);
+
+		sprintf(sub, "%s/%s", path, e->d_name);
+		sprintf(subrel, "%s%s%s", rel, *rel ? "/" : "", e->d_name);
+
+		walk(sub, subrel, false);
+
+		free(sub);
+		free(subrel);
+	}
+	closedir(d);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void usage(void)
+{
+	fprintf(stderr,
+		"usage: px-batch -o <dir> [options] <file or directory>...\n"
+		"\n"
+		"  -o <dir>          write converted images under <dir>\n"
+		"  -f tga|png        output format, the input's by default\n"
+		"  -r                run-length encode TGA output\n"
+		"  -l <level>        PNG compression level, 0-9 (6)\n"
+		"  -c <x,y,w,h>      crop\n"
+		"  -t <transform>    flip-h, flip-v, rotate-cw, rotate-ccw, scale2, scale3,\n"
+		"                    scale2x or scale3x\n"
+		"  -p <palette>      remap colors to a .gpl or .hex palette\n"
+		"  -d                dither when remapping\n"
+		"  -s <width>        split into frames of <width>, or 0 for the sheet's\n"
+		"  -j <threads>      worker threads, one per core by default\n");
+	exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+	int c;
+
+	while ((c = getopt(argc, argv, "o:f:rl:c:t:p:ds:j:")) != -1) {
+		switch (c) {
+		case 'o':
+			opts.outdir = optarg;
+			break;
+		case 'f':
+			if (strcmp(optarg, "tga") && strcmp(optarg, "png"))
+				usage();
+			opts.format = optarg[0] == 't' ? ".tga" : ".png";
+			break;
+		case 'r':
+			opts.rle = true;
+			break;
+		case 'l':
+			opts.level = atoi(optarg);
+			break;
+		case 'c':
+			if (sscanf(optarg, "%d,%d,%d,%d", &opts.cx, &opts.cy, &opts.cw, &opts.ch) != 4 || opts.cw <= 0 || opts.ch <= 0)
+				usage();
+			opts.crop = true;
+			break;
+		case 't':
+			for (int i = 0; i < (int)(sizeof(transforms) / sizeof(transforms[0])); i++) {
+				if (!strcmp(optarg, transforms[i].name))
+					opts.transform = transforms[i].t;
+			}
+			if (opts.transform < 0)
+				usage();
+			break;
+		case 'p':
+			if (!(opts.colors = paletteLoad(optarg, &opts.ncolors))) {
+				fprintf(stderr, "px-batch: couldn't load palette '%s': %s\n", optarg, strerror(errno));
+				return 1;
+			}
+			break;
+		case 'd':
+			opts.dither = true;
+			break;
+		case 's':
+			opts.split = atoi(optarg);
+			break;
+		case 'j':
+			opts.threads = atoi(optarg);
+			break;
+		default:
+			usage();
+		}
+	}
+	if (!opts.outdir || optind == argc || opts.split < -1)
+		usage();
+
+	if (opts.threads <= 0) {
+		long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+		opts.threads = ncpus < 1 ? 1 : ncpus;
+	}
+	opts.threads = opts.threads > MAX_THREADS ? MAX_THREADS : opts.threads;
+
+	queueInit(&paths, QUEUE_DEPTH * opts.threads);
+	queueInit(&loaded, QUEUE_DEPTH * opts.threads);
+	queueInit(&converted, QUEUE_DEPTH * opts.threads);
+
+	struct report r = { 0 };
+	pthread_t readThread, writeThread, workers[MAX_THREADS];
+	double start = now();
+
+	pthread_create(&readThread, NULL, reader, NULL);
+	pthread_create(&writeThread, NULL, writer, &r);
+
+	for (int i = 0; i < opts.threads; i++) {
+		pthread_create(&workers[i], NULL, worker, NULL);
+	}
+	for (int i = optind; i < argc; i++) {
+		const char *base = strrchr(argv[i], '/');
+		struct stat st;
+
+		// Directories are mirrored under the output directory, files go in it.
+		bool dir = stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode);
+
+		walk(argv[i], dir ? "" : base ? base + 1 : argv[i], true);
+	}
+	queueClose(&paths);
+	pthread_join(readThread, NULL);
+
+	for (int i = 0; i < opts.threads; i++) {
+		pthread_join(workers[i], NULL);
+	}
+	queueClose(&converted);
+	pthread_join(writeThread, NULL);
+
+	double elapsed = now() - start;
+
+	if (elapsed <= 0)
+		elapsed = 1e-9;
+
+	fprintf(stderr, "px-batch: converted %ld file(s) in %.2fs with %d thread(s): %.1f files/s, %.1f MB/s read, %.1f MB/s written\n",
+		r.files, elapsed, opts.threads, r.files / elapsed, r.read / elapsed / 1e6, r.written / elapsed / 1e6);
+
+	if (r.failed) {
+		fprintf(stderr, "px-batch: %ld file(s) failed:\n", r.failed);
+
+		for (long i = 0; i < r.failed; i++) {
+			fprintf(stderr, "  %s\n", r.errors[i]);
+			free(r.errors[i]);
+		}
+	}
+	free(r.errors);
+	free(opts.colors);
+
+	for (int i = 0; i < claims.cap; i++) {
+		free(claims.outputs[i]);
+		free(claims.inputs[i]);
+	}
+	free(claims.outputs);
+	free(claims.inputs);
+
+	return r.failed ? 1 : 0;
+}
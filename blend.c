@@ -0,0 +1,260 @@
+//
+// blend.c
+// pixel blending kernels
+//
+// Pixels are in straight (non-premultiplied) alpha. Blending follows the
+// W3C compositing model: the blend function applies where both pixels are
+// present, the source where only it is, and the destination elsewhere.
+// Arithmetic is done in single precision, in a fixed order, so that the
+// vector kernels give exactly the same results as the scalar one.
+//
+#include <inttypes.h>
+
+#include "color.h"
+#include "blend.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BLEND_X86
+#include <immintrin.h>
+#endif
+
+const char *blendNames[BLEND_MODES] = {
+	"normal", "multiply", "screen", "add", "erase"
+};
+
+static void blendInit(struct rgba *, const struct rgba *, int, enum blend, int);
+
+static void (*kernel)(struct rgba *, const struct rgba *, int, enum blend, int) = blendInit;
+static const char *kernelName = "scalar";
+
+static inline float blendChannel(float cs, float cd, enum blend mode)
+{
+	switch (mode) {
+	case BLEND_MULTIPLY: return cs * cd / 255.0f;
+	case BLEND_SCREEN:   return cs + cd - cs * cd / 255.0f;
+	case BLEND_ADD:      return cs + cd > 255.0f ? 255.0f : cs + cd;
+	default:             return cs;
+	}
+}
+
+static inline uint8_t blendRound(float v)
+{
+	v += 0.5f;
+	return v >= 255.0f ? 255 : (uint8_t)v;
+}
+
+//
+// Blend `s` over `d`, with the source alpha scaled by `opacity` (0-255).
+//
+static inline struct rgba blendPixel(struct rgba d, struct rgba s, enum blend mode, int opacity)
+{
+	float as = (float)s.a * (float)opacity / 65025.0f,
+	      ad = (float)d.a / 255.0f;
+
+	if (mode == BLEND_ERASE) { // Remove the source alpha from the destination
+		float ao = (1.0f - as) * ad;
+
+		if (ao == 0.0f)
+			return (struct rgba){0, 0, 0, 0};
+
+		d.a = blendRound(ao * 255.0f);
+		return d;
+	}
+	float ao = as + ad * (1.0f - as);
+
+	if (ao == 0.0f)
+		return (struct rgba){0, 0, 0, 0};
+
+	float t1 = as * (1.0f - ad), // Source only
+	      t2 = as * ad,          // Both
+	      t3 = (1.0f - as) * ad; // Destination only
+
+	const uint8_t *cs = &s.r, *cd = &d.r;
+	struct rgba o;
+	uint8_t *co = &o.r;
+
+	for (int i = 0; i < 3; i++) {
+		float b = blendChannel(cs[i], cd[i], mode);
+		co[i] = blendRound((t1 * cs[i] + t2 * b + t3 * cd[i]) / ao);
+	}
+	o.a = blendRound(ao * 255.0f);
+
+	return o;
+}
+
+void blendSpanScalar(struct rgba *dst, const struct rgba *src, int n, enum blend mode, int opacity)
+{
+	for (int i = 0; i < n; i++) {
+		dst[i] = blendPixel(dst[i], src[i], mode, opacity);
+	}
+}
+
+#ifdef BLEND_X86
+
+//
+// The vector kernels work on one channel of several pixels at a time: each
+// 32-bit lane holds a pixel, which is split into four vectors of floats.
+// Remaining pixels go through the scalar kernel.
+//
+#define SSE_CHANNEL(v, shift) _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, shift), _mm_set1_epi32(0xff)))
+#define SSE_ROUND(v)          _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(v, _mm_set1_ps(0.5f)), _mm_set1_ps(255.0f)))
+
+static inline __m128 sseBlendChannel(__m128 cs, __m128 cd, enum blend mode)
+{
+	switch (mode) {
+	case BLEND_MULTIPLY: return _mm_div_ps(_mm_mul_ps(cs, cd), _mm_set1_ps(255.0f));
+	case BLEND_SCREEN:   return _mm_sub_ps(_mm_add_ps(cs, cd), _mm_div_ps(_mm_mul_ps(cs, cd), _mm_set1_ps(255.0f)));
+	case BLEND_ADD:      return _mm_min_ps(_mm_add_ps(cs, cd), _mm_set1_ps(255.0f));
+	default:             return cs;
+	}
+}
+
+static void blendSpanSSE2(struct rgba *dst, const struct rgba *src, int n, enum blend mode, int opacity)
+{
+	const __m128 one = _mm_set1_ps(1.0f), k255 = _mm_set1_ps(255.0f),
+	             op = _mm_set1_ps((float)opacity), k65025 = _mm_set1_ps(65025.0f);
+	int i = 0;
+
+	for (; i + 4 <= n; i += 4) {
+		__m128i d = _mm_loadu_si128((const __m128i *)&dst[i]),
+		        s = _mm_loadu_si128((const __m128i *)&src[i]), o;
+
+		__m128 as = _mm_div_ps(_mm_mul_ps(SSE_CHANNEL(s, 24), op), k65025),
+		       ad = _mm_div_ps(SSE_CHANNEL(d, 24), k255),
+		       ao;
+
+		if (mode == BLEND_ERASE) {
+			ao = _mm_mul_ps(_mm_sub_ps(one, as), ad);
+			o  = _mm_or_si128(_mm_and_si128(d, _mm_set1_epi32(0xffffff)),
+			                  _mm_slli_epi32(SSE_ROUND(_mm_mul_ps(ao, k255)), 24));
+		} else {
+			ao = _mm_add_ps(as, _mm_mul_ps(ad, _mm_sub_ps(one, as)));
+
+			__m128 t1 = _mm_mul_ps(as, _mm_sub_ps(one, ad)),
+			       t2 = _mm_mul_ps(as, ad),
+			       t3 = _mm_mul_ps(_mm_sub_ps(one, as), ad);
+
+			o = _mm_slli_epi32(SSE_ROUND(_mm_mul_ps(ao, k255)), 24);
+
+			for (int c = 0; c < 24; c += 8) {
+				__m128 cs = SSE_CHANNEL(s, c), cd = SSE_CHANNEL(d, c),
+				       b  = sseBlendChannel(cs, cd, mode),
+				       co = _mm_add_ps(_mm_add_ps(_mm_mul_ps(t1, cs), _mm_mul_ps(t2, b)), _mm_mul_ps(t3, cd));
+
+				o = _mm_or_si128(o, _mm_slli_epi32(SSE_ROUND(_mm_div_ps(co, ao)), c));
+			}
+		}
+		// Fully transparent results are all zeroes.
+		o = _mm_andnot_si128(_mm_castps_si128(_mm_cmpeq_ps(ao, _mm_setzero_ps())), o);
+		_mm_storeu_si128((__m128i *)&dst[i], o);
+	}
+	blendSpanScalar(dst + i, src + i, n - i, mode, opacity);
+}
+
+#define AVX_CHANNEL(v, shift) _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(v, shift), _mm256_set1_epi32(0xff)))
+#define AVX_ROUND(v)          _mm256_cvttps_epi32(_mm256_min_ps(_mm256_add_ps(v, _mm256_set1_ps(0.5f)), _mm256_set1_ps(255.0f)))
+
+__attribute__((target("avx2")))
+static inline __m256 avxBlendChannel(__m256 cs, __m256 cd, enum blend mode)
+{
+	switch (mode) {
+	case BLEND_MULTIPLY: return _mm256_div_ps(_mm256_mul_ps(cs, cd), _mm256_set1_ps(255.0f));
+	case BLEND_SCREEN:   return _mm256_sub_ps(_mm256_add_ps(cs, cd), _mm256_div_ps(_mm256_mul_ps(cs, cd), _mm256_set1_ps(255.0f)));
+	case BLEND_ADD:      return _mm256_min_ps(_mm256_add_ps(cs, cd), _mm256_set1_ps(255.0f));
+	default:             return cs;
+	}
+}
+
+__attribute__((target("avx2")))
+static void blendSpanAVX2(struct rgba *dst, const struct rgba *src, int n, enum blend mode, int opacity)
+{
+	const __m256 one = _mm256_set1_ps(1.0f), k255 = _mm256_set1_ps(255.0f),
+	             op = _mm256_set1_ps((float)opacity), k65025 = _mm256_set1_ps(65025.0f);
+	int i = 0;
+
+	for (; i + 8 <= n; i += 8) {
+		__m256i d = _mm256_loadu_si256((const __m256i *)&dst[i]),
+		        s = _mm256_loadu_si256((const __m256i *)&src[i]), o;
+
+		__m256 as = _mm256_div_ps(_mm256_mul_ps(AVX_CHANNEL(s, 24), op), k65025),
+		       ad = _mm256_div_ps(AVX_CHANNEL(d, 24), k255),
+		       ao;
+
+		if (mode == BLEND_ERASE) {
+			ao = _mm256_mul_ps(_mm256_sub_ps(one, as), ad);
+			o  = _mm256_or_si256(_mm256_and_si256(d, _mm256_set1_epi32(0xffffff)),
+			                     _mm256_slli_epi32(AVX_ROUND(_mm256_mul_ps(ao, k255)), 24));
+		} else {
+			ao = _mm256_add_ps(as, _mm256_mul_ps(ad, _mm256_sub_ps(one, as)));
+
+			__m256 t1 = _mm256_mul_ps(as, _mm256_sub_ps(one, ad)),
+			       t2 = _mm256_mul_ps(as, ad),
+			       t3 = _mm256_mul_ps(_mm256_sub_ps(one, as), ad);
+
+			o = _mm256_slli_epi32(AVX_ROUND(_mm256_mul_ps(ao, k255)), 24);
+
+			for (int c = 0; c < 24; c += 8) {
+				__m256 cs = AVX_CHANNEL(s, c), cd = AVX_CHANNEL(d, c),
+				       b  = avxBlendChannel(cs, cd, mode),
+				       co = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(t1, cs), _mm256_mul_ps(t2, b)), _mm256_mul_ps(t3, cd));
+
+				o = _mm256_or_si256(o, _mm256_slli_epi32(AVX_ROUND(_mm256_div_ps(co, ao)), c));
+			}
+		}
+		o = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(ao, _mm256_setzero_ps(), _CMP_EQ_OQ)), o);
+		_mm256_storeu_si256((__m256i *)&dst[i], o);
+	}
+	blendSpanSSE2(dst + i, src + i, n - i, mode, opacity);
+}
+
+#endif
+
+//
+// Pick the fastest kernel the CPU supports, on first use.
+//
+static void blendInit(struct rgba *dst, const struct rgba *src, int n, enum blend mode, int opacity)
+{
+	kernel = blendSpanScalar;
+
+#ifdef BLEND_X86
+	kernel = blendSpanSSE2;
+	kernelName = "sse2";
+
+	if (__builtin_cpu_supports("avx2")) {
+		kernel = blendSpanAVX2;
+		kernelName = "avx2";
+	}
+#endif
+	kernel(dst, src, n, mode, opacity);
+}
+
+const char *blendKernel(void)
+{
+	if (kernel == blendInit)
+		blendInit(NULL, NULL, 0, BLEND_NORMAL, 255);
+
+	return kernelName;
+}
+
+void blendSpan(struct rgba *dst, const struct rgba *src, int n, enum blend mode, int opacity)
+{
+	kernel(dst, src, n, mode, opacity);
+}
+
+void blendFill(struct rgba *dst, struct rgba color, int n, enum blend mode)
+{
+	struct rgba src[64];
+
+	if (mode == BLEND_NORMAL && color.a == 255) { // Same result, without the arithmetic
+		for (int i = 0; i < n; i++) {
+			dst[i] = color;
+		}
+		return;
+	}
+	for (int i = 0; i < n && i < 64; i++) {
+		src[i] = color;
+	}
+	for (int i = 0; i < n; i += 64) {
+		kernel(dst + i, src, n - i < 64 ? n - i : 64, mode, 255);
+	}
+}
@@ -0,0 +1,19 @@
+//
+// blend.h
+// pixel blending kernels
+//
+enum blend {
+	BLEND_NORMAL,
+	BLEND_MULTIPLY,
+	BLEND_SCREEN,
+	BLEND_ADD,
+	BLEND_ERASE, // Source alpha is removed from the destination
+	BLEND_MODES
+};
+
+extern const char *blendNames[BLEND_MODES];
+
+void        blendSpan(struct rgba *, const struct rgba *, int, enum blend, int);
+void        blendSpanScalar(struct rgba *, const struct rgba *, int, enum blend, int);
+void        blendFill(struct rgba *, struct rgba, int, enum blend);
+const char *blendKernel(void);
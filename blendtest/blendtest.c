@@ -0,0 +1,176 @@
+//
+// blendtest.c
+// blending kernel correctness and throughput
+//
+// usage: make blendtest
+//
+// Every vector kernel the CPU supports is checked against the scalar one,
+// which it must match bit for bit: over every pair of source and
+// destination alphas, with pseudo-random colors, and over every pair of
+// source and destination channel values, with a sample of alphas, for each
+// mode at a sample of opacities. Spans are cut at varying lengths, so that
+// the scalar remainder of the vector kernels is checked too. Then each
+// kernel's throughput is measured per mode.
+//
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The vector kernels are private to blend.c.
+#include "blend.c"
+
+#define PAIRS       65536     // Pixels in a span that holds every pair of 8-bit values
+#define ROUNDS      16        // Random colors tried with every alpha pair
+#define BENCH_SPAN  4096      // Pixels per benchmarked span, to stay in cache
+#define BENCH_BYTES (1 << 28) // Blended per kernel and mode
+
+struct kernel {
+	const char *name;
+	void       (*span)(struct rgba *, const struct rgba *, int, enum blend, int);
+};
+
+static const int opacities[] = {0, 1, 64, 128, 200, 254, 255};
+static const int alphas[]    = {0, 1, 2, 64, 127, 128, 129, 254, 255};
+
+static uint32_t seed = 2463534242u;
+
+static uint32_t xorshift(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+
+	return seed;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//
+// Blend `src` over `dst` with `k` and with the scalar kernel, in spans of
+// varying lengths, and return the number of pixels that differ.
+//
+static long compare(struct kernel *k, const struct rgba *dst, const struct rgba *src, int n, enum blend mode, int opacity)
+{
+	static struct rgba want[PAIRS], got[PAIRS];
+	long bad = 0;
+
+	memcpy(want, dst, n * sizeof(*dst));
+	memcpy(got, dst, n * sizeof(*dst));
+
+	for (int i = 0, len = 1; i < n; i += len, len = len % 37 + 1) {
+		int m = i + len > n ? n - i : len;
+
+		blendSpanScalar(want + i, src + i, m, mode, opacity);
+		k->span(got + i, src + i, m, mode, opacity);
+	}
+	for (int i = 0; i < n; i++) {
+		if (memcmp(&want[i], &got[i], sizeof(*got))) {
+			if (!bad)
+				fprintf(stderr, "blendtest: %s %s opacity %d: %02x%02x%02x%02x over %02x%02x%02x%02x "
+				        "gives %02x%02x%02x%02x, scalar %02x%02x%02x%02x\n",
+				        k->name, blendNames[mode], opacity,
+				        src[i].r, src[i].g, src[i].b, src[i].a, dst[i].r, dst[i].g, dst[i].b, dst[i].a,
+				        got[i].r, got[i].g, got[i].b, got[i].a, want[i].r, want[i].g, want[i].b, want[i].a);
+			bad++;
+		}
+	}
+	return bad;
+}
+
+static long check(struct kernel *k)
+{
+	static struct rgba src[PAIRS], dst[PAIRS];
+	long bad = 0, n = 0;
+
+	for (int m = 0; m < BLEND_MODES; m++) {
+		for (size_t o = 0; o < sizeof(opacities) / sizeof(*opacities); o++) {
+			// Every alpha pair
+			for (int r = 0; r < ROUNDS; r++) {
+				for (int i = 0; i < PAIRS; i++) {
+					uint32_t a = xorshift(), b = xorshift();
+
+					src[i] = (struct rgba){a, a >> 8, a >> 16, i & 0xff};
+					dst[i] = (struct rgba){b, b >> 8, b >> 16, i >> 8};
+				}
+				bad += compare(k, dst, src, PAIRS, m, opacities[o]);
+				n   += PAIRS;
+			}
+			// Every channel pair, with the channels in a different order
+			// in each of r, g and b
+			for (size_t sa = 0; sa < sizeof(alphas) / sizeof(*alphas); sa++) {
+				for (size_t da = 0; da < sizeof(alphas) / sizeof(*alphas); da++) {
+					for (int i = 0; i < PAIRS; i++) {
+						uint8_t x = i & 0xff, y = i >> 8;
+
+						src[i] = (struct rgba){x, y, x ^ y, alphas[sa]};
+						dst[i] = (struct rgba){y, x, 255 - x, alphas[da]};
+					}
+					bad += compare(k, dst, src, PAIRS, m, opacities[o]);
+					n   += PAIRS;
+				}
+			}
+		}
+	}
+	printf("%-6s %ld pixels compared, %ld differ\n", k->name, n, bad);
+
+	return bad;
+}
+
+static void bench(struct kernel *k)
+{
+	static struct rgba src[BENCH_SPAN], dst[BENCH_SPAN];
+	long iterations = BENCH_BYTES / sizeof(src);
+
+	for (int i = 0; i < BENCH_SPAN; i++) {
+		uint32_t a = xorshift(), b = xorshift();
+
+		src[i] = (struct rgba){a, a >> 8, a >> 16, a >> 24};
+		dst[i] = (struct rgba){b, b >> 8, b >> 16, b >> 24};
+	}
+	printf("%-6s", k->name);
+
+	for (int m = 0; m < BLEND_MODES; m++) {
+		double t0 = now();
+
+		for (long i = 0; i < iterations; i++) {
+			k->span(dst, src, BENCH_SPAN, m, 200);
+		}
+		double mpx = iterations * BENCH_SPAN / (now() - t0) / 1e6;
+
+		printf(" %s %.0f Mpx/s%s", blendNames[m], mpx, m < BLEND_MODES - 1 ? "," : "\n");
+	}
+}
+
+int main(void)
+{
+	struct kernel kernels[3] = {{"scalar", blendSpanScalar}};
+	int nkernels = 1;
+	long bad = 0;
+
+#ifdef BLEND_X86
+	kernels[nkernels++] = (struct kernel){"sse2", blendSpanSSE2};
+
+	if (__builtin_cpu_supports("avx2"))
+		kernels[nkernels++] = (struct kernel){"avx2", blendSpanAVX2};
+#endif
+	for (int i = 1; i < nkernels; i++) {
+		bad += check(&kernels[i]);
+	}
+	if (nkernels == 1)
+		printf("no vector kernel on this CPU\n");
+
+	for (int i = 0; i < nkernels; i++) {
+		bench(&kernels[i]);
+	}
+	return bad ? 1 : 0;
+}
@@ -0,0 +1,306 @@
+//
+// cmd.c
+// line-based command socket
+//
+// Clients connect to a Unix domain socket, or pipe into standard input, and
+// send one command per line. Nothing here blocks: input is read as it
+// arrives, and commands are handed out between frames, for as long as the
+// time budget of the frame allows. The rest wait for the next frame. Replies
+// are queued, and written as fast as the client reads them.
+//
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cmd.h"
+
+#define MAX_CLIENTS 16
+#define READ_SIZE   65536
+#define MAX_INPUT   (16 << 20) // Longest line, past which the client is dropped
+
+struct buffer {
+	char   *data;
+	size_t len, cap;
+	size_t off; // Start of the data not yet consumed
+};
+
+struct cmdclient {
+	int           in, out;
+	int           flags;  // Original flags of `in` and `out`, for standard input
+	bool          eof;
+	struct buffer input;
+	struct buffer output;
+};
+
+struct cmdserver {
+	int              fd;   // Listening socket, or -1 for standard input
+	char             *path;
+	struct cmdclient *clients[MAX_CLIENTS];
+	int              nclients;
+};
+
+static void bufferAppend(struct buffer *b, const char *data, size_t n)
+{
+	if (b->off && b->len + n > b->cap) {
+		memmove(b->data, b->data + b->off, b->len - b->off);
+		b->len -= b->off;
+		b->off  = 0;
+	}
+	if (b->len + n > b->cap) {
+		b->cap  = b->cap ? b->cap : 4096;
+		while (b->len + n > b->cap)
+			b->cap *= 2;
+		b->data = realloc(b->data, b->cap);
+	}
+	memcpy(b->data + b->len, data, n);
+	b->len += n;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static struct cmdclient *clientNew(int in, int out)
+{
+	struct cmdclient *c = calloc(1, sizeof(*c));
+
+	c->in    = in;
+	c->out   = out;
+	c->flags = fcntl(in, F_GETFL);
+
+	fcntl(in, F_SETFL, c->flags | O_NONBLOCK);
+
+	if (out != in)
+		fcntl(out, F_SETFL, fcntl(out, F_GETFL) | O_NONBLOCK);
+
+	return c;
+}
+
+static void clientFree(struct cmdclient *c)
+{
+	if (c->in == STDIN_FILENO) {
+		fcntl(c->in, F_SETFL, c->flags);
+		fcntl(c->out, F_SETFL, fcntl(c->out, F_GETFL) & ~O_NONBLOCK);
+	} else {
+		close(c->in);
+	}
+	free(c->input.data);
+	free(c->output.data);
+	free(c);
+}
+
+//
+// Listen on the Unix domain socket at `path`, or read commands from standard
+// input and reply on standard output if `path` is "-". Returns NULL with
+// `errno` set on failure.
+//
+struct cmdserver *cmdListen(const char *path)
+{
+	struct cmdserver *s = calloc(1, sizeof(*s));
+
+	// Clients that hang up shouldn't take px down with them.
+	signal(SIGPIPE, SIG_IGN);
+
+	if (!strcmp(path, "-")) {
+		s->fd = -1;
+		s->clients[s->nclients++] = clientNew(STDIN_FILENO, STDOUT_FILENO);
+		return s;
+	}
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		free(s);
+		errno = ENAMETOOLONG;
+		return NULL;
+	}
+	strcpy(addr.sun_path, path);
+
+	// A socket left behind by a crash would make `bind` fail. Anything else
+	// at `path` is left alone, and `bind` fails on it.
+	struct stat st;
+
+	if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(path);
+
+	if ((s->fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+		free(s);
+		return NULL;
+	}
+	if (bind(s->fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(s->fd, MAX_CLIENTS) < 0) {
+		int err = errno;
+
+		close(s->fd);
+		free(s);
+		errno = err;
+		return NULL;
+	}
+	fcntl(s->fd, F_SETFL, fcntl(s->fd, F_GETFL) | O_NONBLOCK);
+	s->path = strdup(path);
+
+	return s;
+}
+
+static void clientRead(struct cmdclient *c)
+{
+	char chunk[READ_SIZE];
+
+	while (!c->eof && c->input.len - c->input.off < MAX_INPUT) {
+		ssize_t n = read(c->in, chunk, sizeof(chunk));
+
+		if (n > 0)
+			bufferAppend(&c->input, chunk, n);
+		else if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+			c->eof = true;
+		else
+			break;
+	}
+}
+
+static void clientFlush(struct cmdclient *c)
+{
+	struct buffer *b = &c->output;
+
+	while (b->off < b->len) {
+		ssize_t n = write(c->out, b->data + b->off, b->len - b->off);
+
+		if (n > 0) {
+			b->off += n;
+		} else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+			b->off = b->len; // The client is gone; its replies go nowhere.
+			c->eof = true;
+		} else {
+			return;
+		}
+	}
+	b->off = b->len = 0;
+}
+
+//
+// Return the next complete line of input, without its line ending, or NULL.
+//
+static char *clientLine(struct cmdclient *c)
+{
+	struct buffer *b = &c->input;
+
+	if (b->off == b->len)
+		return NULL;
+
+	char *start = b->data + b->off,
+	     *end   = memchr(start, '\n', b->len - b->off);
+
+	if (!end) {
+		// A last line without a newline still counts once the client is done.
+		if (!c->eof)
+			return NULL;
+
+		bufferAppend(b, "\n", 1);
+		start = b->data + b->off;
+		end   = b->data + b->len - 1;
+	}
+	*end = '\0';
+	b->off = end + 1 - b->data;
+
+	if (end > start && end[-1] == '\r')
+		end[-1] = '\0';
+
+	return start;
+}
+
+//
+// Accept new clients, read what they sent, and call `handle` for each
+// complete command until `budget` seconds have passed. Returns the number
+// of commands handled.
+//
+int cmdPoll(struct cmdserver *s, double budget, cmdhandler handle, void *ctx)
+{
+	double deadline = now() + budget;
+	int handled = 0, fd;
+	bool late = false;
+
+	while (s->fd >= 0 && s->nclients < MAX_CLIENTS && (fd = accept(s->fd, NULL, NULL)) >= 0)
+		s->clients[s->nclients++] = clientNew(fd, fd);
+
+	for (int i = 0; i < s->nclients; i++) {
+		struct cmdclient *c = s->clients[i];
+		char *line;
+
+		clientRead(c);
+
+		while (!late && (line = clientLine(c))) {
+			handle(c, line, ctx);
+
+			// Checking the clock costs more than most commands.
+			if (++handled % 64 == 0)
+				late = now() > deadline;
+		}
+		// What's left is part of a line, which would never complete if it
+		// filled the buffer.
+		if (!late && !c->eof && c->input.len - c->input.off >= MAX_INPUT) {
+			cmdReply(c, "error: line longer than %d bytes", MAX_INPUT);
+			c->input.off = c->input.len;
+			c->eof       = true;
+		}
+		clientFlush(c);
+	}
+	// Drop clients that hung up, once their commands have all run.
+	for (int i = 0; i < s->nclients; i++) {
+		struct cmdclient *c = s->clients[i];
+
+		if (c->eof && c->input.off == c->input.len && c->output.len == 0) {
+			clientFree(c);
+			s->clients[i--] = s->clients[--s->nclients];
+		}
+	}
+	return handled;
+}
+
+void cmdWrite(struct cmdclient *c, const char *data, size_t n)
+{
+	bufferAppend(&c->output, data, n);
+}
+
+void cmdReply(struct cmdclient *c, const char *fmt, ...)
+{
+	char line[1024];
+	va_list ap;
+
+	va_start(ap, fmt);
+	int n = vsnprintf(line, sizeof(line), fmt, ap);
+	va_end(ap);
+
+	cmdWrite(c, line, n < (int)sizeof(line) ? n : (int)sizeof(line) - 1);
+	cmdWrite(c, "\n", 1);
+}
+
+void cmdClose(struct cmdserver *s)
+{
+	if (!s)
+		return;
+
+	for (int i = 0; i < s->nclients; i++) {
+		clientFree(s->clients[i]);
+	}
+	if (s->fd >= 0) {
+		close(s->fd);
+		unlink(s->path);
+	}
+	free(s->path);
+	free(s);
+}
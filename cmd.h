@@ -0,0 +1,14 @@
+//
+// cmd.h
+// line-based command socket
+//
+struct cmdserver;
+struct cmdclient;
+
+typedef void (*cmdhandler)(struct cmdclient *, char *, void *);
+
+struct cmdserver *cmdListen(const char *path);
+int               cmdPoll(struct cmdserver *, double, cmdhandler, void *);
+void              cmdReply(struct cmdclient *, const char *, ...);
+void              cmdWrite(struct cmdclient *, const char *, size_t);
+void              cmdClose(struct cmdserver *);
@@ -5,12 +5,81 @@
 static struct binding bindings[] = {
 	// modifier              key               action         callback         argument
 	{GLFW_MOD_CONTROL,       GLFW_KEY_F,       GLFW_PRESS,    createFrame,     { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_N,       GLFW_PRESS,    insertFrame,     { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_D,       GLFW_PRESS,    duplicateFrame,  { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_X,       GLFW_PRESS,    deleteFrame,     { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_LEFT,    GLFW_PRESS,    moveFrame,       { .i = -1 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_RIGHT,   GLFW_PRESS,    moveFrame,       { .i = +1 }},
+	{GLFW_MOD_CONTROL |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_R,       GLFW_PRESS,    reverseFrames,   { 0 }},
+	{GLFW_MOD_ALT,           GLFW_KEY_H,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_FLIP_H }},
+	{GLFW_MOD_ALT,           GLFW_KEY_V,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_FLIP_V }},
+	{GLFW_MOD_ALT,           GLFW_KEY_R,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_ROTATE_CW }},
+	{GLFW_MOD_ALT,           GLFW_KEY_E,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_ROTATE_CCW }},
+	{GLFW_MOD_ALT,           GLFW_KEY_2,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_SCALE_2 }},
+	{GLFW_MOD_ALT,           GLFW_KEY_3,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_SCALE_3 }},
+	{GLFW_MOD_ALT,           GLFW_KEY_S,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_SCALE2X }},
+	{GLFW_MOD_ALT,           GLFW_KEY_D,       GLFW_PRESS,    frameTransform,  { .i = TRANSFORM_SCALE3X }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_H,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_FLIP_H }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_V,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_FLIP_V }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_R,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_ROTATE_CW }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_E,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_ROTATE_CCW }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_2,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_SCALE_2 }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_3,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_SCALE_3 }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_S,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_SCALE2X }},
+	{GLFW_MOD_ALT |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_D,       GLFW_PRESS,    sheetTransform,  { .i = TRANSFORM_SCALE3X }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_P,       GLFW_PRESS,    remapColors,     { .i = false }},
+	{GLFW_MOD_CONTROL |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_P,       GLFW_PRESS,    remapColors,     { .i = true }},
+	{0,                      GLFW_KEY_F5,      GLFW_PRESS,    preview,         { 0 }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F5,      GLFW_PRESS,    resetColors,     { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_F5,      GLFW_PRESS,    commitColors,    { 0 }},
+	{0,                      GLFW_KEY_F6,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_SHIFT, +1} }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F6,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_SHIFT, -1} }},
+	{0,                      GLFW_KEY_F7,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_HUE, +15} }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F7,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_HUE, -15} }},
+	{0,                      GLFW_KEY_F8,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_SATURATION, +10} }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F8,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_SATURATION, -10} }},
+	{0,                      GLFW_KEY_F9,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_LIGHTNESS, +10} }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F9,      GLFW_PRESS,    adjustColors,    { .p = {ADJUST_LIGHTNESS, -10} }},
+	{0,                      GLFW_KEY_F10,     GLFW_PRESS,    adjustColors,    { .p = {ADJUST_LOW, +8} }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F10,     GLFW_PRESS,    adjustColors,    { .p = {ADJUST_LOW, -8} }},
+	{0,                      GLFW_KEY_F11,     GLFW_PRESS,    adjustColors,    { .p = {ADJUST_HIGH, -8} }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F11,     GLFW_PRESS,    adjustColors,    { .p = {ADJUST_HIGH, +8} }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_L,       GLFW_PRESS,    addLayer,        { 0 }},
+	{GLFW_MOD_CONTROL |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_L,       GLFW_PRESS,    deleteLayer,     { 0 }},
+	{0,                      GLFW_KEY_PAGE_UP, GLFW_PRESS,    selectLayer,     { .i = +1 }},
+	{0,                      GLFW_KEY_PAGE_DOWN, GLFW_PRESS,  selectLayer,     { .i = -1 }},
+	{0,                      GLFW_KEY_H,       GLFW_PRESS,    toggleLayer,     { 0 }},
+	{GLFW_MOD_CONTROL,       ']',              GLFW_PRESS,    layerOpacity,    { .i = +32 }},
+	{GLFW_MOD_CONTROL,       '[',              GLFW_PRESS,    layerOpacity,    { .i = -32 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_B,       GLFW_PRESS,    layerBlend,      { 0 }},
 	{GLFW_MOD_CONTROL,       GLFW_KEY_W,       GLFW_PRESS,    saveCopy,        { 0 }},
 	{GLFW_MOD_CONTROL,       GLFW_KEY_S,       GLFW_PRESS,    save,            { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_E,       GLFW_PRESS,    export,          { 0 }},
+	{GLFW_MOD_CONTROL |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_E,       GLFW_PRESS,    exportAtlas,     { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_I,       GLFW_PRESS,    stats,           { 0 }},
+	{0,                      GLFW_KEY_F12,     GLFW_PRESS,    latency,         { 0 }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_F12,     GLFW_PRESS,    fence,           { 0 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_F12,     GLFW_PRESS,    vsync,           { 0 }},
 	{0,                      '.',              GLFW_PRESS,    zoom,            { .i = +1 }},
 	{0,                      ',',              GLFW_PRESS,    zoom,            { .i = -1 }},
 	{0,                      ']',              GLFW_PRESS,    brushSize,       { .i = +1 }},
 	{0,                      '[',              GLFW_PRESS,    brushSize,       { .i = -1 }},
+	{0,                      GLFW_KEY_G,       GLFW_PRESS,    grid,            { .i = +8 }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_G,       GLFW_PRESS,    grid,            { .i = -8 }},
+	{0,                      GLFW_KEY_T,       GLFW_PRESS,    tiling,          { .i = 3 }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_T,       GLFW_PRESS,    tiling,          { .i = 5 }},
 	{0,                      GLFW_KEY_U,       GLFW_PRESS,    undo,            { 0 }},
 	{GLFW_MOD_CONTROL,       GLFW_KEY_R,       GLFW_PRESS,    redo,            { 0 }},
 	{0,                      GLFW_KEY_ENTER,   GLFW_PRESS,    pause,           { 0 }},
@@ -18,8 +87,26 @@ static struct binding bindings[] = {
 	{0,                      GLFW_KEY_RIGHT,   GLFW_PRESS,    move,            { .p = {+50, 0} }},
 	{0,                      GLFW_KEY_DOWN,    GLFW_PRESS,    move,            { .p = {0, +50} }},
 	{0,                      GLFW_KEY_UP,      GLFW_PRESS,    move,            { .p = {0, -50} }},
-	{0,                      GLFW_KEY_B,       GLFW_PRESS,    brush,           { 0 }},
+	{0,                      GLFW_KEY_B,       GLFW_PRESS,    brush,           { .i = BLEND_NORMAL }},
+	{0,                      GLFW_KEY_E,       GLFW_PRESS,    brush,           { .i = BLEND_ERASE }},
 	{0,                      GLFW_KEY_M,       GLFW_PRESS,    marquee,         { 0 }},
+	{0,                      GLFW_KEY_W,       GLFW_PRESS,    wand,            { 0 }},
+	{0,                      GLFW_KEY_L,       GLFW_PRESS,    shape,           { .i = SHAPE_LINE }},
+	{0,                      GLFW_KEY_R,       GLFW_PRESS,    shape,           { .i = SHAPE_RECT }},
+	{0,                      GLFW_KEY_O,       GLFW_PRESS,    shape,           { .i = SHAPE_ELLIPSE }},
+	{0,                      GLFW_KEY_Y,       GLFW_PRESS,    symmetry,        { .i = SYMMETRY_HORIZONTAL }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_Y,       GLFW_PRESS,    symmetry,        { .i = SYMMETRY_VERTICAL }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_Y,       GLFW_PRESS,    symmetry,        { .i = SYMMETRY_FOUR }},
+	{0,                      GLFW_KEY_K,       GLFW_PRESS,    symmetry,        { .i = SYMMETRY_RADIAL }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_K,       GLFW_PRESS,    folds,           { .i = +1 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_K,       GLFW_PRESS,    folds,           { .i = -1 }},
+	{GLFW_MOD_CONTROL,       GLFW_KEY_A,       GLFW_PRESS,    selectAll,       { .i = 1 }},
+	{GLFW_MOD_CONTROL |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_A,       GLFW_PRESS,    selectAll,       { .i = 0 }},
+	{GLFW_MOD_CONTROL |
+	 GLFW_MOD_SHIFT,         GLFW_KEY_I,       GLFW_PRESS,    invertSelection, { 0 }},
+	{0,                      GLFW_KEY_BACKSPACE, GLFW_PRESS,  fillSelection,   { .i = 0 }},
+	{GLFW_MOD_SHIFT,         GLFW_KEY_BACKSPACE, GLFW_PRESS,  fillSelection,   { .i = 1 }},
 	{0,                      GLFW_KEY_SPACE,   GLFW_PRESS,    pan,             { true }},
 	{0,                      GLFW_KEY_SPACE,   GLFW_RELEASE,  pan,             { false }},
 	{0,                      '\'',             GLFW_PRESS,    onion,           { true }},
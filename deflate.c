@@ -0,0 +1,914 @@
+//
+// deflate.c
+// zlib stream compression
+//
+// A self-contained implementation of zlib streams (RFC 1950) holding
+// deflate data (RFC 1951). The compressor finds matches through a hash
+// table of 4-byte prefixes: level 1 only remembers the last position of
+// each prefix and takes the first match it finds, higher levels follow
+// longer hash chains, and from level 4 up, matching is lazy. Blocks are
+// written with dynamic Huffman codes, or stored when that is smaller.
+// Level 0 only stores.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deflate.h"
+
+#define WINDOW     32768
+#define MIN_MATCH  4     // Shortest match looked for; deflate allows 3
+#define MAX_MATCH  258
+#define HASH_BITS  15
+#define MAX_BITS   15    // Longest Huffman code
+#define BLOCK_SYMS 32768 // Symbols per block
+#define FAST_BITS  10    // Huffman codes decoded with a single lookup
+
+static const struct {
+	int  chain;  // Hash chain positions to try
+	int  nice;   // Stop looking once a match is this long
+	int  insert; // Longest match whose positions are all hashed
+	bool lazy;
+} levels[10] = {
+	{    0,   0,         0, false },
+	{    1,  16,         4, false },
+	{    4,  32,        16, false },
+	{    8,  64, MAX_MATCH, false },
+	{    8,  32, MAX_MATCH, true  },
+	{   16,  64, MAX_MATCH, true  },
+	{   32, 128, MAX_MATCH, true  },
+	{   64, 128, MAX_MATCH, true  },
+	{  256, 258, MAX_MATCH, true  },
+	{ 1024, 258, MAX_MATCH, true  },
+};
+
+static const uint16_t lengthBase[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t lengthExtra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t distBase[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t distExtra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// Order in which code length code lengths are sent.
+static const uint8_t clOrder[19] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+static uint32_t adler32(const uint8_t *p, size_t n)
+{
+	uint32_t a = 1, b = 0;
+
+	while (n > 0) {
+		size_t k = n < 5552 ? n : 5552; // Most bytes before `b` can overflow
+
+		for (n -= k; k > 0; k--) {
+			a += *p++;
+			b += a;
+		}
+		a %= 65521;
+		b %= 65521;
+	}
+	return b << 16 | a;
+}
+
+static inline uint16_t reverse(uint16_t code, int len)
+{
+	uint16_t r = 0;
+
+	for (int i = 0; i < len; i++, code >>= 1) {
+		r = (r << 1) | (code & 1);
+	}
+	return r;
+}
+
+//
+// Assign canonical codes to symbols with the given lengths, bit-reversed,
+// since deflate packs Huffman codes starting from their top bit.
+//
+static void huffCodes(const uint8_t *lengths, int n, uint16_t *codes)
+{
+	int count[MAX_BITS + 1] = {0}, next[MAX_BITS + 1];
+
+	for (int i = 0; i < n; i++) {
+		count[lengths[i]]++;
+	}
+	count[0] = 0;
+
+	for (int bits = 1, code = 0; bits <= MAX_BITS; bits++) {
+		code = (code + count[bits - 1]) << 1;
+		next[bits] = code;
+	}
+	for (int i = 0; i < n; i++) {
+		if (lengths[i])
+			codes[i] = reverse(next[lengths[i]]++, lengths[i]);
+	}
+}
+
+//
+// Compute Huffman code lengths of at most `maxbits` for the symbol
+// frequencies `freq`. Codes that come out too long are shortened by
+// taking leaves from the shallower levels, keeping the code complete.
+//
+static void huffLengths(const uint32_t *freq, int n, int maxbits, uint8_t *lengths)
+{
+	int syms[288], nsyms = 0;
+	uint32_t weight[2 * 288];
+	int parent[2 * 288], depth[2 * 288], count[MAX_BITS + 1] = {0};
+
+	memset(lengths, 0, n);
+
+	for (int i = 0; i < n; i++) {
+		if (freq[i])
+			syms[nsyms++] = i;
+	}
+	// Always make at least two codes of one bit, so the code is complete.
+	if (nsyms == 0) {
+		lengths[0] = lengths[1] = 1;
+		return;
+	} else if (nsyms == 1) {
+		lengths[syms[0]] = 1;
+		lengths[syms[0] ? 0 : 1] = 1;
+		return;
+	}
+	// Sort symbols by frequency, and build the tree with two queues: one of
+	// leaves, one of internal nodes, which are created in increasing weight.
+	for (int i = 1; i < nsyms; i++) {
+		int s = syms[i], j = i;
+
+		for (; j > 0 && freq[syms[j - 1]] > freq[s]; j--)
+			syms[j] = syms[j - 1];
+		syms[j] = s;
+	}
+	for (int i = 0; i < nsyms; i++) {
+		weight[i] = freq[syms[i]];
+	}
+	for (int k = nsyms, leaf = 0, node = nsyms; k < 2 * nsyms - 1; k++) {
+		int pick[2];
+
+		for (int p = 0; p < 2; p++) {
+			if (leaf < nsyms && (node >= k || weight[leaf] <= weight[node]))
+				pick[p] = leaf++;
+			else
+				pick[p] = node++;
+		}
+		weight[k] = weight[pick[0]] + weight[pick[1]];
+		parent[pick[0]] = parent[pick[1]] = k;
+	}
+	depth[2 * nsyms - 2] = 0;
+
+	for (int i = 2 * nsyms - 3; i >= 0; i--) {
+		depth[i] = depth[parent[i]] + 1;
+	}
+	for (int i = 0; i < nsyms; i++) {
+		count[depth[i] < maxbits ? depth[i] : maxbits]++;
+	}
+	uint32_t total = 0;
+
+	for (int i = 1; i <= maxbits; i++) {
+		total += (uint32_t)count[i] << (maxbits - i);
+	}
+	while (total != 1u << maxbits) {
+		count[maxbits]--;
+
+		for (int i = maxbits - 1; i > 0; i--) {
+			if (count[i]) {
+				count[i]--;
+				count[i + 1] += 2;
+				break;
+			}
+		}
+		total--;
+	}
+	// The least frequent symbols get the longest codes.
+	for (int bits = maxbits, i = 0; bits > 0; bits--) {
+		for (int c = 0; c < count[bits]; c++) {
+			lengths[syms[i++]] = bits;
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Compression
+///////////////////////////////////////////////////////////////////////////////
+
+struct writer {
+	uint8_t  *out;
+	size_t   n, cap;
+	uint64_t acc;
+	int      count;
+};
+
+struct sym {
+	uint16_t len;  // Literal byte if `dist` is zero
+	uint16_t dist;
+};
+
+static inline int lengthCode(int len)
+{
+	int l = len - 3, b;
+
+	if (len == MAX_MATCH)
+		return 28;
+	if (l < 8)
+		return l;
+
+	b = 31 - __builtin_clz(l);
+	return 4 * (b - 1) + ((l >> (b - 2)) & 3);
+}
+
+static inline int distCode(int dist)
+{
+	int d = dist - 1, b;
+
+	if (d < 4)
+		return d;
+
+	b = 31 - __builtin_clz(d);
+	return 2 * b + ((d >> (b - 1)) & 1);
+}
+
+static void reserve(struct writer *w, size_t n)
+{
+	if (w->n + n <= w->cap)
+		return;
+
+	while (w->n + n > w->cap)
+		w->cap *= 2;
+
+	w->out = realloc(w->out, w->cap);
+}
+
+static inline void put(struct writer *w, uint32_t bits, int n)
+{
+	w->acc |= (uint64_t)bits << w->count;
+	w->count += n;
+
+	if (w->count >= 32) {
+		reserve(w, 4);
+
+		for (int i = 0; i < 4; i++) {
+			w->out[w->n++] = w->acc >> (8 * i);
+		}
+		w->acc >>= 32;
+		w->count -= 32;
+	}
+}
+
+//
+// Pad to a byte boundary, and write out every pending bit.
+//
+static void align(struct writer *w)
+{
+	put(w, 0, (8 - w->count % 8) % 8);
+	reserve(w, 4);
+
+	for (; w->count > 0; w->count -= 8) {
+		w->out[w->n++] = w->acc;
+		w->acc >>= 8;
+	}
+	w->acc = 0;
+	w->count = 0;
+}
+
+static void writeStored(struct writer *w, const uint8_t *raw, size_t n, bool last)
+{
+	do {
+		size_t len = n < 65535 ? n : 65535;
+
+		put(w, last && len == n, 1);
+		put(w, 0, 2);
+		align(w);
+		reserve(w, 4 + len);
+
+		w->out[w->n++] = len;
+		w->out[w->n++] = len >> 8;
+		w->out[w->n++] = ~len;
+		w->out[w->n++] = ~len >> 8;
+
+		memcpy(w->out + w->n, raw, len);
+		w->n += len;
+		raw  += len;
+		n    -= len;
+	} while (n > 0);
+}
+
+//
+// Write the symbols `syms`, which encode the `n` bytes at `raw`, as a
+// single block: with dynamic Huffman codes, or stored if that's smaller.
+//
+static void writeBlock(struct writer *w, const struct sym *syms, int nsyms, const uint8_t *raw, size_t n, bool last)
+{
+	uint32_t lfreq[286] = {0}, dfreq[30] = {0}, cfreq[19] = {0};
+	uint8_t  lens[286 + 30], clens[19];
+	uint16_t lcodes[286], dcodes[30], ccodes[19];
+	uint8_t  rle[286 + 30], rlextra[286 + 30];
+	int      nrle = 0;
+
+	for (int i = 0; i < nsyms; i++) {
+		if (syms[i].dist) {
+			lfreq[257 + lengthCode(syms[i].len)]++;
+			dfreq[distCode(syms[i].dist)]++;
+		} else {
+			lfreq[syms[i].len]++;
+		}
+	}
+	lfreq[256] = 1;
+
+	huffLengths(lfreq, 286, MAX_BITS, lens);
+	huffLengths(dfreq, 30, MAX_BITS, lens + 286);
+
+	int hlit = 286, hdist = 30;
+
+	while (hlit > 257 && !lens[hlit - 1])
+		hlit--;
+	while (hdist > 1 && !lens[286 + hdist - 1])
+		hdist--;
+
+	// Run-length encode the code lengths, which are sent as one sequence.
+	memmove(lens + hlit, lens + 286, hdist);
+
+	for (int i = 0, total = hlit + hdist; i < total;) {
+		int run = 1;
+
+		while (i + run < total && lens[i + run] == lens[i])
+			run++;
+
+		if (lens[i] == 0 && run >= 3) {
+			run = run > 138 ? 138 : run;
+			rle[nrle] = run >= 11 ? 18 : 17;
+			rlextra[nrle++] = run >= 11 ? run - 11 : run - 3;
+		} else if (lens[i] != 0 && run >= 4) {
+			run = run > 7 ? 7 : run;
+			rle[nrle] = lens[i];
+			rlextra[nrle++] = 0;
+			rle[nrle] = 16;
+			rlextra[nrle++] = run - 1 - 3;
+		} else {
+			run = 1;
+			rle[nrle] = lens[i];
+			rlextra[nrle++] = 0;
+		}
+		i += run;
+	}
+	for (int i = 0; i < nrle; i++) {
+		cfreq[rle[i]]++;
+	}
+	huffLengths(cfreq, 19, 7, clens);
+
+	int hclen = 19;
+
+	while (hclen > 4 && !clens[clOrder[hclen - 1]])
+		hclen--;
+
+	memmove(lens + 286, lens + hlit, hdist);
+	memset(lens + hlit, 0, 286 - hlit);
+
+	// Compare the size of both encodings.
+	size_t bits = 3 + 5 + 5 + 4 + 3 * hclen;
+
+	for (int i = 0; i < 19; i++) {
+		bits += cfreq[i] * (clens[i] + (i == 16 ? 2 : i == 17 ? 3 : i == 18 ? 7 : 0));
+	}
+	for (int i = 0; i < 286; i++) {
+		bits += lfreq[i] * (lens[i] + (i > 256 ? lengthExtra[i - 257] : 0));
+	}
+	for (int i = 0; i < 30; i++) {
+		bits += dfreq[i] * (lens[286 + i] + distExtra[i]);
+	}
+	if (bits / 8 >= n + 5 * (n / 65535 + 1)) {
+		writeStored(w, raw, n, last);
+		return;
+	}
+	huffCodes(lens, 286, lcodes);
+	huffCodes(lens + 286, 30, dcodes);
+	huffCodes(clens, 19, ccodes);
+
+	put(w, last, 1);
+	put(w, 2, 2);
+	put(w, hlit - 257, 5);
+	put(w, hdist - 1, 5);
+	put(w, hclen - 4, 4);
+
+	for (int i = 0; i < hclen; i++) {
+		put(w, clens[clOrder[i]], 3);
+	}
+	for (int i = 0; i < nrle; i++) {
+		put(w, ccodes[rle[i]], clens[rle[i]]);
+
+		if (rle[i] >= 16)
+			put(w, rlextra[i], rle[i] == 16 ? 2 : rle[i] == 17 ? 3 : 7);
+	}
+	for (int i = 0; i < nsyms; i++) {
+		struct sym s = syms[i];
+
+		if (!s.dist) {
+			put(w, lcodes[s.len], lens[s.len]);
+			continue;
+		}
+		int lc = lengthCode(s.len), dc = distCode(s.dist);
+
+		put(w, lcodes[257 + lc], lens[257 + lc]);
+		put(w, s.len - lengthBase[lc], lengthExtra[lc]);
+		put(w, dcodes[dc], lens[286 + dc]);
+		put(w, s.dist - distBase[dc], distExtra[dc]);
+	}
+	put(w, lcodes[256], lens[256]);
+}
+
+struct matcher {
+	const uint8_t *src;
+	size_t        n;
+	int32_t       *head, *prev;
+	int           chain, nice;
+};
+
+static inline uint32_t hash(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+static inline void insert(struct matcher *m, size_t pos)
+{
+	uint32_t h = hash(m->src + pos);
+
+	if (m->prev)
+		m->prev[pos & (WINDOW - 1)] = m->head[h];
+
+	m->head[h] = pos;
+}
+
+static inline int matchLength(const uint8_t *a, const uint8_t *b, int max)
+{
+	int len = 0;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	for (; len + 8 <= max; len += 8) {
+		uint64_t x, y;
+
+		memcpy(&x, a + len, 8);
+		memcpy(&y, b + len, 8);
+
+		if (x != y)
+			return len + __builtin_ctzll(x ^ y) / 8;
+	}
+#endif
+	while (len < max && a[len] == b[len])
+		len++;
+
+	return len;
+}
+
+//
+// Find the longest match for the bytes at `pos` that is longer than `min`,
+// before `pos` is inserted. Returns 0 if there is none.
+//
+static int findMatch(struct matcher *m, size_t pos, int min, int *dist)
+{
+	const uint8_t *p = m->src + pos;
+	int32_t cand = m->head[hash(p)];
+	int max = m->n - pos < MAX_MATCH ? m->n - pos : MAX_MATCH,
+	    best = min > MIN_MATCH - 1 ? min : MIN_MATCH - 1;
+	size_t limit = pos > WINDOW ? pos - WINDOW : 0;
+
+	if (best >= max)
+		return 0;
+
+	for (int chain = m->chain; cand >= 0 && (size_t)cand >= limit && chain > 0; chain--) {
+		const uint8_t *c = m->src + cand;
+
+		if (c[best] == p[best]) {
+			int len = matchLength(c, p, max);
+
+			if (len > best) {
+				best  = len;
+				*dist = pos - cand;
+
+				if (len >= m->nice || len == max)
+					break;
+			}
+		}
+		if (!m->prev)
+			break;
+
+		cand = m->prev[cand & (WINDOW - 1)];
+	}
+	return best >= MIN_MATCH && best > min ? best : 0;
+}
+
+uint8_t *deflateEncode(const uint8_t *src, size_t n, int level, size_t *outlen)
+{
+	struct writer w = { .cap = n / 2 + 1024 };
+
+	level = level < 0 ? 0 : level > 9 ? 9 : level;
+	w.out = malloc(w.cap);
+
+	// Header: deflate with a 32K window, and a hint of the level used.
+	w.out[0] = 0x78;
+	w.out[1] = (level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3) << 6;
+	w.out[1] += 31 - ((w.out[0] << 8) + w.out[1]) % 31;
+	w.n = 2;
+
+	if (level == 0) {
+		writeStored(&w, src, n, true);
+	} else {
+		struct matcher m = {
+			.src   = src,
+			.n     = n,
+			.head  = malloc(sizeof(int32_t) << HASH_BITS),
+			.prev  = levels[level].chain > 1 ? malloc(sizeof(int32_t) * WINDOW) : NULL,
+			.chain = levels[level].chain,
+			.nice  = levels[level].nice
+		};
+		struct sym *syms = malloc(BLOCK_SYMS * sizeof(*syms));
+		int nsyms = 0, insertMax = levels[level].insert;
+		size_t pos = 0, start = 0, covered = 0;
+
+		memset(m.head, 0xff, sizeof(int32_t) << HASH_BITS);
+
+#define EMIT(l, d) do { \
+		syms[nsyms++] = (struct sym){ (l), (d) }; \
+		covered += (d) ? (l) : 1; \
+		if (nsyms == BLOCK_SYMS) { \
+			writeBlock(&w, syms, nsyms, src + start, covered - start, false); \
+			start = covered; \
+			nsyms = 0; \
+		} \
+	} while (0)
+
+		if (!levels[level].lazy) {
+			while (pos < n) {
+				int len = 0, dist = 0;
+
+				if (pos + MIN_MATCH <= n) {
+					len = findMatch(&m, pos, 0, &dist);
+					insert(&m, pos);
+				}
+				if (!len) {
+					EMIT(src[pos], 0);
+					pos++;
+					continue;
+				}
+				EMIT(len, dist);
+
+				size_t end = pos + len;
+
+				if (len <= insertMax) {
+					for (pos++; pos < end && pos + MIN_MATCH <= n; pos++)
+						insert(&m, pos);
+				}
+				pos = end;
+			}
+		} else {
+			// A match is only taken once the next position is known not to
+			// start a longer one.
+			int prevLen = 0, prevDist = 0;
+			bool pending = false;
+
+			while (pos < n) {
+				int len = 0, dist = 0;
+
+				if (pos + MIN_MATCH <= n) {
+					if (prevLen < m.nice)
+						len = findMatch(&m, pos, prevLen, &dist);
+					insert(&m, pos);
+				}
+				if (pending && prevLen && !len) {
+					size_t end = pos - 1 + prevLen;
+
+					EMIT(prevLen, prevDist);
+
+					for (pos++; pos < end && pos + MIN_MATCH <= n; pos++)
+						insert(&m, pos);
+
+					pos = end;
+					pending = false;
+					prevLen = 0;
+					continue;
+				}
+				if (pending)
+					EMIT(src[pos - 1], 0);
+
+				prevLen  = len;
+				prevDist = dist;
+				pending  = true;
+				pos++;
+			}
+			if (pending) {
+				if (prevLen)
+					EMIT(prevLen, prevDist);
+				else
+					EMIT(src[pos - 1], 0);
+			}
+		}
+#undef EMIT
+		writeBlock(&w, syms, nsyms, src + start, covered - start, true);
+
+		free(syms);
+		free(m.head);
+		free(m.prev);
+	}
+	align(&w);
+	reserve(&w, 4);
+
+	uint32_t sum = adler32(src, n);
+
+	for (int i = 3; i >= 0; i--) {
+		w.out[w.n++] = sum >> (8 * i);
+	}
+	*outlen = w.n;
+
+	return w.out;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Decompression
+///////////////////////////////////////////////////////////////////////////////
+
+struct reader {
+	const uint8_t *src;
+	size_t        n, pos;
+	uint64_t      acc;
+	int           count;
+};
+
+struct huff {
+	uint16_t fast[1 << FAST_BITS]; // Length << 9 | symbol, or 0 if longer
+	uint16_t count[MAX_BITS + 1];  // Codes of each length
+	uint16_t symbols[288];         // Symbols in canonical order
+};
+
+//
+// Fill the bit buffer. Reading past the end yields zeroes; `pos` keeps
+// counting, so that overruns can be detected.
+//
+static inline void refill(struct reader *r)
+{
+	while (r->count <= 56) {
+		r->acc |= (uint64_t)(r->pos < r->n ? r->src[r->pos] : 0) << r->count;
+		r->pos++;
+		r->count += 8;
+	}
+}
+
+static inline uint32_t bits(struct reader *r, int n)
+{
+	if (r->count < n)
+		refill(r);
+
+	uint32_t v = r->acc & ((1ull << n) - 1);
+
+	r->acc >>= n;
+	r->count -= n;
+
+	return v;
+}
+
+static bool huffBuild(struct huff *h, const uint8_t *lengths, int n)
+{
+	uint16_t offs[MAX_BITS + 2], codes[288];
+	int left = 1;
+
+	memset(h->count, 0, sizeof(h->count));
+	memset(h->fast, 0, sizeof(h->fast));
+
+	for (int i = 0; i < n; i++) {
+		h->count[lengths[i]]++;
+	}
+	h->count[0] = 0;
+
+	for (int len = 1; len <= MAX_BITS; len++) {
+		left = (left << 1) - h->count[len];
+
+		if (left < 0) // Over-subscribed
+			return false;
+	}
+	offs[1] = 0;
+
+	for (int len = 1; len <= MAX_BITS; len++) {
+		offs[len + 1] = offs[len] + h->count[len];
+	}
+	for (int i = 0; i < n; i++) {
+		if (lengths[i])
+			h->symbols[offs[lengths[i]]++] = i;
+	}
+	huffCodes(lengths, n, codes);
+
+	for (int i = 0; i < n; i++) {
+		if (lengths[i] && lengths[i] <= FAST_BITS) {
+			for (int k = codes[i]; k < 1 << FAST_BITS; k += 1 << lengths[i])
+				h->fast[k] = lengths[i] << 9 | i;
+		}
+	}
+	return true;
+}
+
+static inline int decode(struct reader *r, const struct huff *h)
+{
+	if (r->count < MAX_BITS)
+		refill(r);
+
+	uint16_t e = h->fast[r->acc & ((1 << FAST_BITS) - 1)];
+
+	if (e) {
+		r->acc >>= e >> 9;
+		r->count -= e >> 9;
+		return e & 511;
+	}
+	// Codes longer than the table, decoded canonically, a bit at a time.
+	for (int len = 1, code = 0, first = 0, index = 0; len <= MAX_BITS; len++) {
+		code |= (r->acc >> (len - 1)) & 1;
+
+		if (code - h->count[len] < first) {
+			r->acc >>= len;
+			r->count -= len;
+			return h->symbols[index + (code - first)];
+		}
+		index += h->count[len];
+		first += h->count[len];
+		first <<= 1;
+		code <<= 1;
+	}
+	return -1;
+}
+
+static bool inflateCodes(struct reader *r, const struct huff *lit, const struct huff *dist, uint8_t *dst, size_t dstlen, size_t *out)
+{
+	size_t o = *out;
+
+	for (;;) {
+		int sym = decode(r, lit);
+
+		if (sym < 256) {
+			if (sym < 0 || o >= dstlen)
+				return false;
+
+			dst[o++] = sym;
+		} else if (sym == 256) {
+			break;
+		} else {
+			sym -= 257;
+
+			if (sym >= 29)
+				return false;
+
+			size_t len = lengthBase[sym] + bits(r, lengthExtra[sym]);
+			int dsym = decode(r, dist);
+
+			if (dsym < 0 || dsym >= 30)
+				return false;
+
+			size_t d = distBase[dsym] + bits(r, distExtra[dsym]);
+
+			if (d > o || len > dstlen - o)
+				return false;
+
+			// Overlapping copies repeat the last `d` bytes, so the part
+			// already copied can be copied again, doubling every time.
+			for (size_t from = o - d, n; len > 0; o += n, len -= n) {
+				n = o - from < len ? o - from : len;
+				memcpy(dst + o, dst + from, n);
+			}
+		}
+		if (r->pos > r->n + 8)
+			return false;
+	}
+	*out = o;
+
+	return true;
+}
+
+static bool inflateDynamic(struct reader *r, struct huff *lit, struct huff *dist)
+{
+	uint8_t lens[286 + 30] = {0}, clens[19] = {0};
+	int hlit  = bits(r, 5) + 257,
+	    hdist = bits(r, 5) + 1,
+	    hclen = bits(r, 4) + 4;
+	struct huff cl;
+
+	if (hlit > 286 || hdist > 30)
+		return false;
+
+	for (int i = 0; i < hclen; i++) {
+		clens[clOrder[i]] = bits(r, 3);
+	}
+	if (!huffBuild(&cl, clens, 19))
+		return false;
+
+	for (int i = 0; i < hlit + hdist;) {
+		int sym = decode(r, &cl), run, val = 0;
+
+		if (sym < 0) {
+			return false;
+		} else if (sym < 16) {
+			lens[i++] = sym;
+			continue;
+		} else if (sym == 16) {
+			if (i == 0)
+				return false;
+			val = lens[i - 1];
+			run = 3 + bits(r, 2);
+		} else if (sym == 17) {
+			run = 3 + bits(r, 3);
+		} else {
+			run = 11 + bits(r, 7);
+		}
+		if (i + run > hlit + hdist)
+			return false;
+
+		while (run--)
+			lens[i++] = val;
+	}
+	if (!lens[256])
+		return false;
+
+	return huffBuild(lit, lens, hlit) && huffBuild(dist, lens + hlit, hdist);
+}
+
+//
+// Decompress the zlib stream `src` into `dst`, which must be exactly the
+// size of the original data. Returns 0 on success.
+//
+int deflateDecode(const uint8_t *src, size_t n, uint8_t *dst, size_t dstlen)
+{
+	struct huff *lit = malloc(2 * sizeof(*lit)), *dist = lit + 1;
+	struct reader r = { .src = src, .n = n, .pos = 2 };
+	size_t out = 0;
+	bool last = false, ok = true;
+
+	if (n < 6 || (src[0] & 0x0f) != 8 || (src[0] >> 4) > 7 || ((src[0] << 8) + src[1]) % 31 || (src[1] & 0x20)) {
+		free(lit);
+		return -1;
+	}
+	while (ok && !last) {
+		last = bits(&r, 1);
+
+		switch (bits(&r, 2)) {
+		case 0: { // Stored
+				bits(&r, r.count % 8);
+
+				uint32_t len = bits(&r, 16), nlen = bits(&r, 16);
+
+				// Go back to reading bytes from where the bits end.
+				r.pos  -= r.count / 8;
+				r.acc   = 0;
+				r.count = 0;
+
+				if ((len ^ 0xffff) != nlen || r.pos > n || len > n - r.pos || len > dstlen - out) {
+					ok = false;
+					break;
+				}
+				memcpy(dst + out, src + r.pos, len);
+				r.pos += len;
+				out   += len;
+			}
+			break;
+		case 1: { // Fixed codes
+				uint8_t lens[288];
+
+				memset(lens, 8, 144);
+				memset(lens + 144, 9, 112);
+				memset(lens + 256, 7, 24);
+				memset(lens + 280, 8, 8);
+				huffBuild(lit, lens, 288);
+
+				memset(lens, 5, 30);
+				huffBuild(dist, lens, 30);
+
+				ok = inflateCodes(&r, lit, dist, dst, dstlen, &out);
+			}
+			break;
+		case 2:
+			ok = inflateDynamic(&r, lit, dist) && inflateCodes(&r, lit, dist, dst, dstlen, &out);
+			break;
+		default:
+			ok = false;
+			break;
+		}
+	}
+	free(lit);
+
+	// The checksum follows, on a byte boundary.
+	r.pos -= r.count / 8;
+
+	if (!ok || out != dstlen || r.pos + 4 > n)
+		return -1;
+
+	const uint8_t *p = src + r.pos;
+	uint32_t sum = (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+
+	return sum == adler32(dst, dstlen) ? 0 : -1;
+}
@@ -0,0 +1,6 @@
+//
+// deflate.h
+// zlib stream compression
+//
+uint8_t *deflateEncode(const uint8_t *src, size_t n, int level, size_t *outlen);
+int      deflateDecode(const uint8_t *src, size_t n, uint8_t *dst, size_t dstlen);
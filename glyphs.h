@@ -0,0 +1,1338 @@
+int glyphsWidth = 764;uint32_t glyphsData[] = {
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa, 0xffaaaaaa,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffaaaaaa, 0xffaaaaaa,
+0xffaaaaaa, 0xffaaaaaa, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000 };
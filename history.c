@@ -0,0 +1,561 @@
+//
+// history.c
+// persistent undo history
+//
+// The undo history of a sheet is kept in a file next to it, so that it
+// outlives the session. Every new undo state is appended as a record with
+// the table of its tiles, followed by the tiles that aren't in the file
+// yet, each compressed on its own so that it can be read back alone. A
+// state recorded at position `i` of the timeline replaces the states from
+// `i` on, the way a new edit discards the redo branch. Undos and redos
+// append a small record that moves the current position.
+//
+// The file is memory-mapped when opened, and only the record headers are
+// read: the tiles of a state are read when it's undone to. Records left
+// behind by discarded branches and cursor moves are dead weight, so once
+// they make up most of the file, it is rewritten with the timeline alone.
+//
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "color.h"
+#include "tiles.h"
+#include "deflate.h"
+#include "history.h"
+
+#define HISTORY_STATE  0x53485850 // "PXHS"
+#define HISTORY_CURSOR 0x43485850 // "PXHC"
+#define HISTORY_LEVEL  1
+#define HISTORY_DEAD   (1 << 20) // Bytes of dead records worth rewriting the file for
+#define HISTORY_SIDE   (1 << 16) // Sheets are smaller than this on either side
+
+#define TILE_BYTES sizeof(((struct tile *)0)->pixels)
+
+struct record {
+	uint32_t magic;
+	uint32_t index;        // Position in the timeline
+	uint32_t fw, fh, w, h; // Sheet and cell dimensions
+	uint32_t nlayers;
+	uint32_t ntiles;       // Entries in the table of tiles
+	uint32_t fresh;        // Tiles first written with this record
+	uint32_t pixels;       // Bytes of those tiles, each a length and a zlib stream
+	uint32_t table;        // Bytes of the compressed table
+	uint32_t sum;          // Checksum of the fields above and the layers
+};
+
+static uint32_t fnv(uint32_t h, const void *data, size_t n)
+{
+	const uint8_t *p = data;
+
+	for (size_t i = 0; i < n; i++) {
+		h ^= p[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static uint32_t recordSum(const struct record *r, const int32_t *layers)
+{
+	uint32_t h = fnv(2166136261u, r, offsetof(struct record, sum));
+
+	return fnv(h, layers, r->nlayers * 3 * sizeof(*layers));
+}
+
+static size_t recordSize(const struct record *r)
+{
+	return sizeof(*r) + r->nlayers * 3 * sizeof(int32_t) + r->pixels + r->table;
+}
+
+//
+// Copy `n` bytes at `offset` of the file to `dst`, from the mapping if
+// they're in it.
+//
+static bool readAt(struct history *h, long offset, void *dst, size_t n)
+{
+	if (offset < 0 || offset + (long)n > h->size)
+		return false;
+
+	if (offset + n <= h->mapsize) {
+		memcpy(dst, h->map + offset, n);
+		return true;
+	}
+	return pread(fileno(h->fp), dst, n, offset) == (ssize_t)n;
+}
+
+//
+// Read the compressed tile at `offset`, with its length, to `out`, which
+// holds TILE_BYTES * 2. Returns the bytes read, or 0 on error.
+//
+static size_t readBlob(struct history *h, long offset, uint8_t *out)
+{
+	uint32_t len;
+
+	if (!readAt(h, offset, &len, sizeof(len)) || len > TILE_BYTES * 2 - sizeof(len) ||
+	    !readAt(h, offset + sizeof(len), out + sizeof(len), len))
+		return 0;
+
+	memcpy(out, &len, sizeof(len));
+
+	return sizeof(len) + len;
+}
+
+static bool readTile(struct history *h, uint32_t id, struct rgba *pixels)
+{
+	uint8_t blob[TILE_BYTES * 2];
+	size_t  n = readBlob(h, h->tiles[id], blob);
+
+	return n && !deflateDecode(blob + sizeof(uint32_t), n - sizeof(uint32_t), (uint8_t *)pixels, TILE_BYTES);
+}
+
+//
+// Index the `n` compressed tiles in the `size` bytes at `offset`. Returns
+// false, without indexing any, if they don't fill those bytes exactly.
+//
+static bool addTiles(struct history *h, long offset, uint32_t n, long size)
+{
+	uint32_t first = h->ntiles;
+	long     end   = offset + size;
+
+	if (h->ntiles + n > h->tcap) {
+		while (h->ntiles + n > h->tcap)
+			h->tcap = h->tcap ? h->tcap * 2 : 1024;
+
+		h->tiles = realloc(h->tiles, h->tcap * sizeof(*h->tiles));
+	}
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t len;
+
+		if (!readAt(h, offset, &len, sizeof(len)) || offset + (long)sizeof(len) + len > end) {
+			h->ntiles = first;
+			return false;
+		}
+		h->tiles[h->ntiles++] = offset;
+		offset += sizeof(len) + len;
+	}
+	if (offset != end) {
+		h->ntiles = first;
+		return false;
+	}
+	return true;
+}
+
+//
+// Read the record at `offset` and apply it to the timeline. Returns false
+// if it's cut short or corrupt.
+//
+static bool historyScan(struct history *h, long offset, long *next)
+{
+	struct record r;
+
+	if (!readAt(h, offset, &r, sizeof(r)))
+		return false;
+
+	if ((r.magic != HISTORY_STATE && r.magic != HISTORY_CURSOR) || r.nlayers > 1 << 16 ||
+	    offset + (long)recordSize(&r) > h->size)
+		return false;
+
+	int32_t *layers = malloc(r.nlayers * 3 * sizeof(*layers) + 1);
+
+	if (!readAt(h, offset + sizeof(r), layers, r.nlayers * 3 * sizeof(*layers)) || recordSum(&r, layers) != r.sum) {
+		free(layers);
+		return false;
+	}
+	if (r.magic == HISTORY_CURSOR) {
+		free(layers);
+
+		if (r.index >= (uint32_t)h->nstates)
+			return false;
+
+		h->current = r.index;
+		h->dead   += sizeof(r);
+	} else {
+		// The table must have a tile for every cell of every layer, or
+		// restoring the state would index past it.
+		if (r.index > (uint32_t)h->nstates || !r.fw || !r.fh || !r.w || !r.h || r.w % r.fw || r.h % r.fh ||
+		    r.w >= HISTORY_SIDE || r.h >= HISTORY_SIDE || r.nlayers != r.h / r.fh ||
+		    r.ntiles != (uint64_t)(r.w / r.fw) * r.nlayers * tilesPerFrame(r.fw, r.fh) ||
+		    !addTiles(h, offset + sizeof(r) + r.nlayers * 3 * sizeof(*layers), r.fresh, r.pixels)) {
+			free(layers);
+			return false;
+		}
+		for (int i = r.index; i < h->nstates; i++) {
+			h->dead += h->states[i].bytes;
+			free(h->states[i].layers);
+		}
+		if ((h->nstates = r.index) == h->cap) {
+			h->cap = h->cap ? h->cap * 2 : 64;
+			h->states = realloc(h->states, h->cap * sizeof(*h->states));
+		}
+		h->states[h->nstates++] = (struct historystate){
+			.offset  = offset,
+			.bytes   = recordSize(&r),
+			.fw      = r.fw,
+			.fh      = r.fh,
+			.w       = r.w,
+			.h       = r.h,
+			.ntiles  = r.ntiles,
+			.nlayers = r.nlayers,
+			.layers  = layers
+		};
+		h->current = r.index;
+	}
+	*next = offset + recordSize(&r);
+
+	return true;
+}
+
+static bool recordWrite(FILE *fp, const struct record *r, const int32_t *layers,
+                        const uint8_t *pixels, const uint8_t *table)
+{
+	return fwrite(r, sizeof(*r), 1, fp) == 1 &&
+	       (!r->nlayers || fwrite(layers, sizeof(*layers), r->nlayers * 3, fp) == r->nlayers * 3) &&
+	       (!r->pixels || fwrite(pixels, 1, r->pixels, fp) == r->pixels) &&
+	       (!r->table || fwrite(table, 1, r->table, fp) == r->table);
+}
+
+//
+// Read the table of tile numbers of the state recorded at `offset`, into
+// `ids`, which holds `n`.
+//
+static bool readTable(struct history *h, long offset, uint32_t *ids, int n)
+{
+	struct record r;
+
+	if (!readAt(h, offset, &r, sizeof(r)) || r.magic != HISTORY_STATE || r.ntiles != (uint32_t)n)
+		return false;
+
+	uint8_t *table = malloc(r.table + 1);
+	bool ok = readAt(h, offset + recordSize(&r) - r.table, table, r.table) &&
+	          !deflateDecode(table, r.table, (uint8_t *)ids, n * sizeof(*ids));
+
+	free(table);
+
+	return ok;
+}
+
+//
+// Rewrite the file at `path` with the states of the timeline alone, and
+// only the tiles they use, renumbered in order of first use. Compressed
+// tiles are copied as they are. The new file is written next to the old
+// one and renamed over it, so that a crash leaves one of the two.
+//
+static bool historyCompact(struct history *h, const char *path)
+{
+	char tmp[strlen(path) + 5];
+	FILE *fp;
+
+	sprintf(tmp, "%s.tmp", path);
+
+	if (!(fp = fopen(tmp, "wb")))
+		return false;
+
+	uint32_t *map = calloc(h->ntiles + 1, sizeof(*map)), next = 0;
+	bool ok = true;
+
+	for (int i = 0; ok && i < h->nstates; i++) {
+		struct historystate *st = &h->states[i];
+		uint32_t *ids = malloc(st->ntiles * sizeof(*ids) + 1);
+		uint8_t *pixels = NULL, *table = NULL;
+		size_t npixels = 0, cap = 0, len = 0;
+		uint32_t fresh = 0;
+
+		ok = readTable(h, st->offset, ids, st->ntiles);
+
+		for (int j = 0; ok && j < st->ntiles; j++) {
+			if (!(ok = ids[j] < h->ntiles))
+				break;
+
+			if (!map[ids[j]]) {
+				if (npixels + TILE_BYTES * 2 > cap) {
+					cap    = cap * 2 + TILE_BYTES * 2;
+					pixels = realloc(pixels, cap);
+				}
+				size_t n = readBlob(h, h->tiles[ids[j]], pixels + npixels);
+
+				ok = n > 0;
+				npixels += n;
+				fresh++;
+				map[ids[j]] = ++next;
+			}
+			ids[j] = map[ids[j]] - 1;
+		}
+		if (ok)
+			ok = (table = deflateEncode((uint8_t *)ids, st->ntiles * sizeof(*ids), HISTORY_LEVEL, &len)) != NULL;
+
+		if (ok) {
+			struct record r = {
+				.magic = HISTORY_STATE, .index = i,
+				.fw = st->fw, .fh = st->fh, .w = st->w, .h = st->h,
+				.nlayers = st->nlayers, .ntiles = st->ntiles,
+				.fresh = fresh, .pixels = npixels, .table = len
+			};
+			r.sum = recordSum(&r, st->layers);
+			ok = recordWrite(fp, &r, st->layers, pixels, table);
+		}
+		free(ids);
+		free(pixels);
+		free(table);
+	}
+	if (ok && h->current != h->nstates - 1) {
+		struct record r = { .magic = HISTORY_CURSOR, .index = h->current };
+
+		r.sum = recordSum(&r, NULL);
+		ok = recordWrite(fp, &r, NULL, NULL, NULL);
+	}
+	ok = fflush(fp) == 0 && fsync(fileno(fp)) == 0 && ok;
+	fclose(fp);
+
+	if (ok && rename(tmp, path) == 0) // Tiles in memory keep their place in the file
+		tilesRenumber(map, h->ntiles);
+	else
+		remove(tmp);
+
+	free(map);
+
+	return ok;
+}
+
+//
+// Open the history file at `path`, creating it if needed, and read the
+// timeline it holds. A record cut short by a crash is dropped. If most of
+// the file is dead records, it's compacted first.
+//
+struct history *historyOpen(const char *path)
+{
+	FILE *fp = fopen(path, "a+b");
+	struct stat st;
+
+	if (!fp)
+		return NULL;
+
+	if (fstat(fileno(fp), &st)) {
+		fclose(fp);
+		return NULL;
+	}
+	struct history *h = calloc(1, sizeof(*h));
+
+	h->fp      = fp;
+	h->size    = st.st_size;
+	h->current = -1;
+
+	if (h->size > 0) {
+		void *map = mmap(NULL, h->size, PROT_READ, MAP_SHARED, fileno(fp), 0);
+
+		if (map != MAP_FAILED) {
+			h->map     = map;
+			h->maplen  = h->size;
+			h->mapsize = h->size;
+		}
+	}
+	long offset = 0;
+
+	while (offset < h->size && historyScan(h, offset, &offset))
+		;
+
+	if (offset < h->size) {
+		// The mapping stays valid over the part that's kept.
+		if (ftruncate(fileno(fp), offset) == 0)
+			h->size = offset;
+		if (h->mapsize > (size_t)offset)
+			h->mapsize = offset;
+	}
+	if (h->dead > HISTORY_DEAD && h->dead * 2 > h->size && historyCompact(h, path)) {
+		historyClose(h);
+		return historyOpen(path);
+	}
+	return h;
+}
+
+//
+// Empty the file, to start a new timeline in it.
+//
+void historyReset(struct history *h)
+{
+	if (ftruncate(fileno(h->fp), 0))
+		return;
+
+	for (int i = 0; i < h->nstates; i++) {
+		free(h->states[i].layers);
+	}
+	h->size    = 0;
+	h->mapsize = 0;
+	h->ntiles  = 0;
+	h->nstates = 0;
+	h->current = -1;
+	h->dead    = 0;
+
+	tilesRenumber(NULL, 0);
+}
+
+static bool historyAppend(struct history *h, const struct record *r, const int32_t *layers,
+                          const uint8_t *pixels, const uint8_t *table)
+{
+	bool ok = recordWrite(h->fp, r, layers, pixels, table);
+
+	// Flush every record, so that tiles can be read back with `pread`.
+	ok = fflush(h->fp) == 0 && ok;
+
+	if (!ok) { // Don't leave a broken record for the next ones to follow
+		clearerr(h->fp);
+		if (ftruncate(fileno(h->fp), h->size))
+			return false;
+	}
+	return ok;
+}
+
+//
+// Record the `n` tiles of a `w * h` sheet with `fw * fh` cells as the state
+// at position `index`, and make it current. `layers` holds the opacity,
+// visibility and blend mode of each of the `nlayers` layers. Returns the
+// offset to read the tiles back from, or -1 on error.
+//
+long historyWrite(struct history *h, int index, struct tile **tiles, int n,
+                  int fw, int fh, int w, int hh, const int32_t *layers, int nlayers)
+{
+	uint32_t *ids = malloc(n * sizeof(*ids) + 1);
+	struct tile **fresh = malloc(n * sizeof(*fresh) + 1);
+	uint32_t nfresh = 0;
+	uint8_t *pixels = NULL;
+	size_t npixels = 0, len;
+	bool ok = true;
+
+	// Tiles remember their number in the file, so that each is only
+	// written once.
+	for (int i = 0; i < n; i++) {
+		if (!tiles[i]->saved) {
+			tiles[i]->saved = h->ntiles + nfresh + 1;
+			fresh[nfresh++] = tiles[i];
+		}
+		ids[i] = tiles[i]->saved - 1;
+	}
+	for (uint32_t i = 0; ok && i < nfresh; i++) {
+		uint8_t *z = deflateEncode((uint8_t *)fresh[i]->pixels, TILE_BYTES, HISTORY_LEVEL, &len);
+		uint32_t zlen = len;
+
+		if ((ok = z && len <= TILE_BYTES * 2 - sizeof(zlen))) {
+			pixels = realloc(pixels, npixels + sizeof(zlen) + len);
+			memcpy(pixels + npixels, &zlen, sizeof(zlen));
+			memcpy(pixels + npixels + sizeof(zlen), z, len);
+			npixels += sizeof(zlen) + len;
+		}
+		free(z);
+	}
+	uint8_t *table = ok ? deflateEncode((uint8_t *)ids, n * sizeof(*ids), HISTORY_LEVEL, &len) : NULL;
+	struct record r = {
+		.magic = HISTORY_STATE, .index = index,
+		.fw = fw, .fh = fh, .w = w, .h = hh,
+		.nlayers = nlayers, .ntiles = n, .fresh = nfresh, .pixels = npixels, .table = len
+	};
+	r.sum = recordSum(&r, layers);
+
+	long offset = h->size;
+
+	if (!table || !historyAppend(h, &r, layers, pixels, table)) {
+		for (uint32_t i = 0; i < nfresh; i++) {
+			fresh[i]->saved = 0;
+		}
+		offset = -1;
+	} else {
+		h->size += recordSize(&r);
+		addTiles(h, offset + sizeof(r) + nlayers * 3 * sizeof(*layers), nfresh, npixels);
+	}
+	free(ids);
+	free(fresh);
+	free(pixels);
+	free(table);
+
+	return offset;
+}
+
+//
+// Record that the state at position `index` is now current.
+//
+void historyCursor(struct history *h, int index)
+{
+	struct record r = { .magic = HISTORY_CURSOR, .index = index };
+
+	r.sum = recordSum(&r, NULL);
+
+	if (historyAppend(h, &r, NULL, NULL, NULL))
+		h->size += sizeof(r);
+}
+
+//
+// Read back the `n` tiles of the state recorded at `offset`. The caller
+// owns the references. Returns NULL if they can't be read.
+//
+struct tile **historyRead(struct history *h, long offset, int n)
+{
+	uint32_t *ids = malloc(n * sizeof(*ids) + 1);
+	struct tile **tiles = malloc(n * sizeof(*tiles) + 1);
+	int i = 0;
+
+	if (readTable(h, offset, ids, n)) {
+		size_t cap = 64;
+
+		while (cap < (size_t)n * 2)
+			cap *= 2;
+
+		// Tiles read so far, by number, as tables share most of them.
+		struct { struct tile *t; uint32_t id; } *seen = calloc(cap, sizeof(*seen));
+
+		for (; i < n && ids[i] < h->ntiles; i++) {
+			size_t k = ids[i] * 0x9e3779b1u & (cap - 1);
+
+			while (seen[k].t && seen[k].id != ids[i])
+				k = (k + 1) & (cap - 1);
+
+			if (seen[k].t) {
+				tiles[i] = seen[k].t;
+				tileRetain(tiles[i]);
+				continue;
+			}
+			struct rgba pixels[TILE_SIZE * TILE_SIZE];
+
+			if (!readTile(h, ids[i], pixels))
+				break;
+
+			tiles[i] = tileIntern(pixels, TILE_SIZE, TILE_SIZE, TILE_SIZE);
+
+			if (!tiles[i]->saved)
+				tiles[i]->saved = ids[i] + 1;
+
+			seen[k].t  = tiles[i];
+			seen[k].id = ids[i];
+		}
+		free(seen);
+	}
+	free(ids);
+
+	if (i < n) {
+		tilesRelease(tiles, i);
+		return NULL;
+	}
+	return tiles;
+}
+
+void historyClose(struct history *h)
+{
+	if (!h)
+		return;
+
+	for (int i = 0; i < h->nstates; i++) {
+		free(h->states[i].layers);
+	}
+	if (h->map)
+		munmap(h->map, h->maplen);
+
+	fclose(h->fp);
+	free(h->states);
+	free(h->tiles);
+	free(h);
+}
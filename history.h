@@ -0,0 +1,36 @@
+//
+// history.h
+// persistent undo history
+//
+struct historystate {
+	long    offset; // Of its record, to read the tiles back from
+	long    bytes;  // Size of its record
+	int     fw, fh;
+	int     w, h;
+	int     ntiles;
+	int     nlayers;
+	int32_t *layers; // Opacity, visibility and blend mode of each layer
+};
+
+struct history {
+	FILE     *fp;
+	uint8_t  *map;     // The file as it was when opened, or NULL
+	size_t   maplen;
+	size_t   mapsize;  // Bytes of the mapping that are still in the file
+	long     size;     // Bytes in the file
+	long     dead;     // Bytes of records no longer in the timeline, when opened
+	long     *tiles;   // Where the pixels of each tile written are
+	uint32_t ntiles, tcap;
+
+	// The timeline found when the file was opened
+	struct historystate *states;
+	int                 nstates, cap;
+	int                 current;
+};
+
+struct history *historyOpen(const char *);
+long            historyWrite(struct history *, int, struct tile **, int, int, int, int, int, const int32_t *, int);
+void            historyReset(struct history *);
+void            historyCursor(struct history *, int);
+struct tile   **historyRead(struct history *, long, int);
+void            historyClose(struct history *);
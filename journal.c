@@ -0,0 +1,245 @@
+//
+// journal.c
+// append-only autosave journal
+//
+// Every committed edit is appended as the rectangle of pixels that changed,
+// so a crash loses at most the stroke in progress. Once the journal grows
+// past a few multiples of the sheet size, it is compacted into a single
+// full-sheet record. The sheet holds every layer, one frame high each, from
+// the bottom layer of the stack at the top of the sheet up to the top layer
+// at its bottom.
+//
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "color.h"
+#include "journal.h"
+
+#define JOURNAL_MAGIC         0x524a5850 // "PXJR"
+#define JOURNAL_COMPACT_RATIO 4
+
+struct record {
+	uint32_t magic;
+	uint32_t w, h, fw, fh; // Sheet and cell dimensions after the edit
+	uint32_t x, y, rw, rh; // Rectangle that changed
+	uint32_t sum;          // Checksum of the fields above and the payload
+};
+
+static uint32_t fnv(uint32_t h, const void *data, size_t n)
+{
+	const uint8_t *p = data;
+
+	for (size_t i = 0; i < n; i++) {
+		h ^= p[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static uint32_t recordSum(struct record *r, const struct rgba *pixels)
+{
+	uint32_t h = fnv(2166136261u, r, offsetof(struct record, sum));
+
+	return fnv(h, pixels, r->rw * r->rh * sizeof(*pixels));
+}
+
+//
+// Append a record for the rectangle `(x, y, rw, rh)`, whose pixels are
+// packed in `pixels`.
+//
+static bool journalWrite(struct journal *j, FILE *fp, const struct rgba *pixels, int w, int h, int fw, int fh,
+                         int x, int y, int rw, int rh)
+{
+	struct record r = {
+		.magic = JOURNAL_MAGIC,
+		.w = w, .h = h, .fw = fw, .fh = fh,
+		.x = x, .y = y, .rw = rw, .rh = rh
+	};
+	r.sum = recordSum(&r, pixels);
+
+	if (!fwrite(&r, sizeof(r), 1, fp))
+		return false;
+	if (!fwrite(pixels, rw * rh * sizeof(*pixels), 1, fp))
+		return false;
+
+	// Flush every record: this is what makes the journal survive a crash.
+	fflush(fp);
+
+	j->size += sizeof(r) + rw * rh * sizeof(*pixels);
+	j->nrecords++;
+
+	return true;
+}
+
+struct journal *journalOpen(const char *path)
+{
+	struct journal *j = malloc(sizeof(*j));
+
+	j->fp       = NULL; // Opened lazily, on the first edit
+	j->path     = malloc(strlen(path) + 1);
+	j->size     = 0;
+	j->nrecords = 0;
+
+	strcpy(j->path, path);
+
+	return j;
+}
+
+//
+// Return true if recording `rect` (x, y, w, h) of a `w * h` sheet would
+// rather compact the journal, because it has grown past a few sheets.
+//
+bool journalCompactDue(struct journal *j, const int *rect, int w, int h)
+{
+	long bytes = (long)rect[2] * rect[3] * sizeof(struct rgba);
+
+	return j->nrecords > 0 && j->size + bytes > JOURNAL_COMPACT_RATIO * (long)w * h * sizeof(struct rgba);
+}
+
+//
+// Append the rectangle `rect` (x, y, w, h) of the sheet, which has just
+// been edited. `pixels` holds the rectangle only.
+//
+void journalRecord(struct journal *j, const struct rgba *pixels, int w, int h, int fw, int fh, const int *rect)
+{
+	if (!j->fp && !(j->fp = fopen(j->path, "ab")))
+		return;
+
+	journalWrite(j, j->fp, pixels, w, h, fw, fh, rect[0], rect[1], rect[2], rect[3]);
+}
+
+//
+// Replace the journal with a single record holding the full sheet. The new
+// journal is written next to the old one and renamed over it, so a crash
+// during compaction leaves one of the two intact.
+//
+void journalCompact(struct journal *j, const struct rgba *pixels, int w, int h, int fw, int fh)
+{
+	char tmp[strlen(j->path) + 5];
+	FILE *fp;
+
+	sprintf(tmp, "%s.tmp", j->path);
+
+	if (!(fp = fopen(tmp, "wb")))
+		return;
+
+	j->size = 0;
+	j->nrecords = 0;
+
+	if (!journalWrite(j, fp, pixels, w, h, fw, fh, 0, 0, w, h)) {
+		fclose(fp);
+		remove(tmp);
+		return;
+	}
+	// The new journal must be on disk before it replaces the old one, or a
+	// power loss after the rename could leave neither.
+	fsync(fileno(fp));
+	fclose(fp);
+
+	if (j->fp)
+		fclose(j->fp);
+
+	rename(tmp, j->path);
+	j->fp = fopen(j->path, "ab");
+}
+
+//
+// Discard the journal, eg. after the sheet has been saved in full.
+//
+void journalReset(struct journal *j)
+{
+	if (j->fp) {
+		fclose(j->fp);
+		j->fp = NULL;
+	}
+	remove(j->path);
+
+	j->size = 0;
+	j->nrecords = 0;
+}
+
+void journalClose(struct journal *j)
+{
+	if (j->fp)
+		fclose(j->fp);
+
+	free(j->path);
+	free(j);
+}
+
+//
+// Apply the records of the journal at `path` on top of `pixels`, which may be
+// reallocated if the sheet was resized. Replay stops at the first torn or
+// corrupt record, and the journal is cut there, so that the records of the
+// next session follow the last good one instead of the torn bytes. Returns
+// the number of records applied, or -1 if there is no journal.
+//
+int journalReplay(const char *path, struct rgba **pixels, int *w, int *h, int *fw, int *fh)
+{
+	FILE *fp = fopen(path, "rb");
+	struct record r;
+	long good = 0; // End of the last good record
+	int n = 0;
+
+	if (!fp)
+		return -1;
+
+	while (fread(&r, sizeof(r), 1, fp)) {
+		if (r.magic != JOURNAL_MAGIC || r.w == 0 || r.h == 0 || r.w > 0xffff || r.h > 0xffff)
+			break;
+		if (r.x + r.rw > r.w || r.y + r.rh > r.h || r.fw == 0 || r.fh == 0)
+			break;
+
+		struct rgba *rect = malloc(r.rw * r.rh * sizeof(*rect));
+
+		if (fread(rect, sizeof(*rect), r.rw * r.rh, fp) != r.rw * r.rh) {
+			free(rect);
+			break;
+		}
+		uint32_t sum = fnv(2166136261u, &r, offsetof(struct record, sum));
+		sum = fnv(sum, rect, r.rw * r.rh * sizeof(*rect));
+
+		if (sum != r.sum) {
+			free(rect);
+			break;
+		}
+		if (r.w != *w || r.h != *h) { // Sheet was resized
+			struct rgba *resized = calloc(r.w * r.h, sizeof(*resized));
+
+			int cw = *w < (int)r.w ? *w : (int)r.w,
+			    ch = *h < (int)r.h ? *h : (int)r.h;
+
+			for (int y = 0; y < ch; y++) {
+				memcpy(&resized[y * r.w], &(*pixels)[y * *w], cw * sizeof(*resized));
+			}
+			free(*pixels);
+
+			*pixels = resized;
+			*w = r.w;
+			*h = r.h;
+		}
+		for (uint32_t y = 0; y < r.rh; y++) {
+			memcpy(&(*pixels)[(r.y + y) * r.w + r.x], &rect[y * r.rw], r.rw * sizeof(*rect));
+		}
+		*fw = r.fw;
+		*fh = r.fh;
+		n++;
+		good = ftell(fp);
+
+		free(rect);
+	}
+	fseek(fp, 0, SEEK_END);
+
+	if (ftell(fp) > good)
+		truncate(path, good);
+	fclose(fp);
+
+	return n;
+}
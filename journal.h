@@ -0,0 +1,18 @@
+//
+// journal.h
+// append-only autosave journal
+//
+struct journal {
+	FILE *fp;
+	char *path;
+	long size;     // Bytes appended since the last compaction
+	int  nrecords; // Records appended since the last compaction
+};
+
+struct journal *journalOpen(const char *path);
+bool            journalCompactDue(struct journal *, const int *, int, int);
+void            journalRecord(struct journal *, const struct rgba *, int, int, int, int, const int *);
+void            journalCompact(struct journal *, const struct rgba *, int, int, int, int);
+void            journalReset(struct journal *);
+void            journalClose(struct journal *);
+int             journalReplay(const char *, struct rgba **, int *, int *, int *, int *);
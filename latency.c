@@ -0,0 +1,122 @@
+//
+// latency.c
+// input to display latency histogram
+//
+// Input callbacks record the time they ran. Once a frame has been rendered,
+// the inputs waiting are attached to it, and when that frame is on screen,
+// the time since each of them goes into the histogram. Times are in seconds,
+// as returned by `glfwGetTime`.
+//
+#include <stdlib.h>
+#include <string.h>
+
+#include "latency.h"
+
+#define BUCKET_MS   0.1  // Histogram resolution
+#define BUCKETS     2000 // Up to 200ms; slower frames go in the last bucket
+#define MAX_PENDING 1024 // Inputs kept per frame, beyond which they're dropped
+
+static struct {
+	double        pending[MAX_PENDING];  // Inputs not yet rendered
+	int           npending;
+	double        inflight[MAX_PENDING]; // Inputs in the frame being shown
+	int           ninflight;
+
+	unsigned long buckets[BUCKETS];
+	unsigned long count;
+	double        sum, max;
+} lat;
+
+void latencyInput(double t)
+{
+	if (lat.npending < MAX_PENDING)
+		lat.pending[lat.npending++] = t;
+}
+
+//
+// The frame about to be shown reflects every input so far.
+//
+void latencyRendered(void)
+{
+	int n = lat.npending;
+
+	if (lat.ninflight + n > MAX_PENDING)
+		n = MAX_PENDING - lat.ninflight;
+
+	memcpy(lat.inflight + lat.ninflight, lat.pending, n * sizeof(*lat.pending));
+	lat.ninflight += n;
+	lat.npending = 0;
+}
+
+//
+// The last rendered frame is on screen, at time `t`.
+//
+void latencyPresented(double t)
+{
+	for (int i = 0; i < lat.ninflight; i++) {
+		double ms = (t - lat.inflight[i]) * 1000.0;
+		int b = (int)(ms / BUCKET_MS);
+
+		if (ms < 0)
+			continue;
+
+		lat.buckets[b < BUCKETS ? b : BUCKETS - 1]++;
+		lat.count++;
+		lat.sum += ms;
+
+		if (ms > lat.max)
+			lat.max = ms;
+	}
+	lat.ninflight = 0;
+}
+
+void latencyReset(void)
+{
+	memset(lat.buckets, 0, sizeof(lat.buckets));
+	lat.count = 0;
+	lat.sum   = 0;
+	lat.max   = 0;
+}
+
+//
+// Return the latency under which a fraction `q` of inputs were shown.
+//
+static double quantile(double q)
+{
+	unsigned long rank = (unsigned long)(q * (lat.count - 1)), seen = 0;
+
+	for (int b = 0; b < BUCKETS; b++) {
+		seen += lat.buckets[b];
+
+		// Buckets are reported by their upper bound, which the slowest input
+		// may be under.
+		if (seen > rank)
+			return b == BUCKETS - 1 || (b + 1) * BUCKET_MS > lat.max ? lat.max : (b + 1) * BUCKET_MS;
+	}
+	return lat.max;
+}
+
+struct latencystats latencyStats(void)
+{
+	struct latencystats s = { .count = lat.count };
+
+	if (!lat.count)
+		return s;
+
+	s.mean = lat.sum / lat.count;
+	s.p50  = quantile(0.50);
+	s.p90  = quantile(0.90);
+	s.p99  = quantile(0.99);
+	s.max  = lat.max;
+
+	for (int b = 0; b < BUCKETS; b++) {
+		double ms = b * BUCKET_MS;
+		int r = 0;
+
+		while (r < LATENCY_RANGES - 1 && ms >= (1 << r))
+			r++;
+
+		s.ranges[r] += lat.buckets[b];
+	}
+	return s;
+}
@@ -0,0 +1,17 @@
+//
+// latency.h
+// input to display latency histogram
+//
+#define LATENCY_RANGES 9 // Ranges shown: under 1ms, 2ms, 4ms ... 128ms, and over
+
+struct latencystats {
+	unsigned long count;
+	double        mean, p50, p90, p99, max; // In milliseconds
+	unsigned long ranges[LATENCY_RANGES];
+};
+
+void                latencyInput(double);
+void                latencyRendered(void);
+void                latencyPresented(double);
+void                latencyReset(void);
+struct latencystats latencyStats(void);
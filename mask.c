@@ -0,0 +1,363 @@
+//
+// mask.c
+// selection masks
+//
+// A mask holds one bit per pixel, packed into 64-bit words, row by row.
+// Combining masks is a loop over words, and code that clips against a mask
+// asks it for runs of set bits, skipping empty words whole. A 4096x4096
+// mask is 2MB.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "color.h"
+#include "mask.h"
+
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+#define ROW(m, y) (&(m)->bits[(size_t)(y) * (m)->words])
+
+//
+// Mask of the bits in the last word of a row that are inside the mask.
+//
+static inline uint64_t tail(const struct mask *m)
+{
+	return m->w % 64 ? (UINT64_C(1) << m->w % 64) - 1 : ~UINT64_C(0);
+}
+
+//
+// Number of set bits in `x`. Without a popcount instruction in the target,
+// which isn't in baseline x86-64, this is faster than the builtin's call.
+//
+static inline int popcount(uint64_t x)
+{
+	x = x - (x >> 1 & UINT64_C(0x5555555555555555));
+	x = (x & UINT64_C(0x3333333333333333)) + (x >> 2 & UINT64_C(0x3333333333333333));
+	x = (x + (x >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+
+	return x * UINT64_C(0x0101010101010101) >> 56;
+}
+
+//
+// Set bits `x0` to `x1` of `row`.
+//
+static void setRun(uint64_t *row, int x0, int x1)
+{
+	if (x0 >= x1)
+		return;
+
+	int w0 = x0 / 64, w1 = (x1 - 1) / 64;
+	uint64_t first = ~UINT64_C(0) << x0 % 64,
+	         last  = ~UINT64_C(0) >> (63 - (x1 - 1) % 64);
+
+	if (w0 == w1) {
+		row[w0] |= first & last;
+		return;
+	}
+	row[w0] |= first;
+
+	for (int i = w0 + 1; i < w1; i++) {
+		row[i] = ~UINT64_C(0);
+	}
+	row[w1] |= last;
+}
+
+struct mask *maskNew(int w, int h)
+{
+	struct mask *m = malloc(sizeof(*m));
+
+	m->w     = w;
+	m->h     = h;
+	m->words = (w + 63) / 64;
+	m->bits  = calloc((size_t)m->words * h, sizeof(*m->bits));
+
+	return m;
+}
+
+//
+// Resize the mask to `w * h`, keeping the bits that are still inside it.
+//
+void maskResize(struct mask *m, int w, int h)
+{
+	if (w == m->w && h == m->h)
+		return;
+
+	struct mask *n = maskNew(w, h);
+
+	for (int y = 0; y < min(h, m->h); y++) {
+		memcpy(ROW(n, y), ROW(m, y), min(n->words, m->words) * sizeof(*n->bits));
+
+		if (w < m->w)
+			ROW(n, y)[n->words - 1] &= tail(n);
+	}
+	free(m->bits);
+	*m = *n;
+	free(n);
+}
+
+void maskFree(struct mask *m)
+{
+	if (!m)
+		return;
+
+	free(m->bits);
+	free(m);
+}
+
+void maskClear(struct mask *m)
+{
+	memset(m->bits, 0, (size_t)m->words * m->h * sizeof(*m->bits));
+}
+
+void maskFill(struct mask *m)
+{
+	memset(m->bits, 0xff, (size_t)m->words * m->h * sizeof(*m->bits));
+
+	for (int y = 0; y < m->h; y++) {
+		ROW(m, y)[m->words - 1] &= tail(m);
+	}
+}
+
+//
+// Add the rectangle from `x0, y0` to `x1, y1`, exclusive, clipped to the
+// mask.
+//
+void maskRect(struct mask *m, int x0, int y0, int x1, int y1)
+{
+	x0 = max(x0, 0);
+	y0 = max(y0, 0);
+	x1 = min(x1, m->w);
+	y1 = min(y1, m->h);
+
+	for (int y = y0; y < y1; y++) {
+		setRun(ROW(m, y), x0, x1);
+	}
+}
+
+//
+// Combine `src` into `m`, which must be the same size.
+//
+void maskCombine(struct mask *m, const struct mask *src, enum maskop op)
+{
+	size_t n = (size_t)m->words * m->h;
+	uint64_t *d = m->bits;
+	const uint64_t *s = src->bits;
+
+	switch (op) {
+	case MASK_REPLACE:
+		memcpy(d, s, n * sizeof(*d));
+		break;
+	case MASK_UNION:
+		for (size_t i = 0; i < n; i++)
+			d[i] |= s[i];
+		break;
+	case MASK_SUBTRACT:
+		for (size_t i = 0; i < n; i++)
+			d[i] &= ~s[i];
+		break;
+	case MASK_INTERSECT:
+		for (size_t i = 0; i < n; i++)
+			d[i] &= s[i];
+		break;
+	}
+}
+
+void maskInvert(struct mask *m)
+{
+	size_t n = (size_t)m->words * m->h;
+
+	for (size_t i = 0; i < n; i++) {
+		m->bits[i] = ~m->bits[i];
+	}
+	for (int y = 0; y < m->h; y++) {
+		ROW(m, y)[m->words - 1] &= tail(m);
+	}
+}
+
+bool maskGet(const struct mask *m, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= m->w || y >= m->h)
+		return false;
+
+	return ROW(m, y)[x / 64] >> x % 64 & 1;
+}
+
+size_t maskCount(const struct mask *m)
+{
+	size_t n = (size_t)m->words * m->h, count = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		count += popcount(m->bits[i]);
+	}
+	return count;
+}
+
+bool maskEmpty(const struct mask *m)
+{
+	size_t n = (size_t)m->words * m->h;
+
+	for (size_t i = 0; i < n; i++) {
+		if (m->bits[i])
+			return false;
+	}
+	return true;
+}
+
+//
+// Find the smallest rectangle holding every set bit. Returns false if there
+// are none.
+//
+bool maskBounds(const struct mask *m, int *x0, int *y0, int *x1, int *y1)
+{
+	*x0 = m->w;
+	*y0 = m->h;
+	*x1 = *y1 = 0;
+
+	for (int y = 0; y < m->h; y++) {
+		const uint64_t *row = ROW(m, y);
+		int i = 0, j = m->words - 1;
+
+		while (i <= j && !row[i])
+			i++;
+
+		if (i > j)
+			continue;
+
+		while (!row[j])
+			j--;
+
+		*x0 = min(*x0, i * 64 + __builtin_ctzll(row[i]));
+		*x1 = max(*x1, j * 64 + 64 - __builtin_clzll(row[j]));
+		*y0 = min(*y0, y);
+		*y1 = y + 1;
+	}
+	return *y1 > 0;
+}
+
+//
+// Find the first run of set bits of row `y` between `*x` and `end`. The
+// start of the run is stored in `*x`, and its length returned, or 0 if
+// there are none left.
+//
+int maskSpan(const struct mask *m, int y, int *x, int end)
+{
+	const uint64_t *row = ROW(m, y);
+	int start = *x;
+
+	end = min(end, m->w);
+
+	if (start >= end)
+		return 0;
+
+	int i = start / 64, last = (end - 1) / 64;
+	uint64_t word = row[i] & ~UINT64_C(0) << start % 64;
+
+	while (!word) {
+		if (++i > last)
+			return 0;
+		word = row[i];
+	}
+	start = i * 64 + __builtin_ctzll(word);
+
+	if (start >= end)
+		return 0;
+
+	// The run ends at the first clear bit after its start.
+	word = ~row[i] & ~UINT64_C(0) << start % 64;
+
+	while (!word && ++i <= last) {
+		word = ~row[i];
+	}
+	int stop = word ? i * 64 + __builtin_ctzll(word) : end;
+
+	*x = start;
+
+	return min(stop, end) - start;
+}
+
+static inline bool matches(struct rgba a, struct rgba b, int tolerance)
+{
+	return abs(a.r - b.r) <= tolerance && abs(a.g - b.g) <= tolerance &&
+	       abs(a.b - b.b) <= tolerance && abs(a.a - b.a) <= tolerance;
+}
+
+//
+// Add every pixel of the `m->w * m->h` pixels that is within `tolerance` of
+// color `c`, in every channel.
+//
+void maskColor(struct mask *m, const struct rgba *pixels, struct rgba c, int tolerance)
+{
+	for (int y = 0; y < m->h; y++) {
+		const struct rgba *p = &pixels[(size_t)y * m->w];
+		uint64_t *row = ROW(m, y);
+
+		for (int i = 0; i < m->words; i++) {
+			int n = min(64, m->w - i * 64);
+			uint64_t word = 0;
+
+			for (int b = 0; b < n; b++) {
+				word |= (uint64_t)matches(p[i * 64 + b], c, tolerance) << b;
+			}
+			row[i] |= word;
+		}
+	}
+}
+
+//
+// Add the pixels connected to `x, y`, horizontally or vertically, that are
+// within `tolerance` of its color. Pixels already in the mask are treated
+// as visited, so `m` should usually start out empty.
+//
+void maskFlood(struct mask *m, const struct rgba *pixels, int x, int y, int tolerance)
+{
+	if (x < 0 || y < 0 || x >= m->w || y >= m->h)
+		return;
+
+	struct rgba c = pixels[(size_t)y * m->w + x];
+	struct seed { int x, y; } *stack = malloc(64 * sizeof(*stack));
+	int n = 0, cap = 64;
+
+	stack[n++] = (struct seed){ x, y };
+
+	// Fill whole runs of the row, then look for runs to continue from in the
+	// rows above and below.
+	while (n > 0) {
+		struct seed p = stack[--n];
+		const struct rgba *row = &pixels[(size_t)p.y * m->w];
+
+		if (maskGet(m, p.x, p.y) || !matches(row[p.x], c, tolerance))
+			continue;
+
+		int x0 = p.x, x1 = p.x + 1;
+
+		while (x0 > 0 && !maskGet(m, x0 - 1, p.y) && matches(row[x0 - 1], c, tolerance))
+			x0--;
+		while (x1 < m->w && !maskGet(m, x1, p.y) && matches(row[x1], c, tolerance))
+			x1++;
+
+		setRun(ROW(m, p.y), x0, x1);
+
+		for (int ny = p.y - 1; ny <= p.y + 1; ny += 2) {
+			if (ny < 0 || ny >= m->h)
+				continue;
+
+			const struct rgba *next = &pixels[(size_t)ny * m->w];
+			bool inside = false;
+
+			for (int nx = x0; nx < x1; nx++) {
+				bool ok = !maskGet(m, nx, ny) && matches(next[nx], c, tolerance);
+
+				if (ok && !inside) {
+					if (n == cap)
+						stack = realloc(stack, (cap *= 2) * sizeof(*stack));
+					stack[n++] = (struct seed){ nx, ny };
+				}
+				inside = ok;
+			}
+		}
+	}
+	free(stack);
+}
@@ -0,0 +1,32 @@
+//
+// mask.h
+// selection masks
+//
+enum maskop {
+	MASK_REPLACE,
+	MASK_UNION,
+	MASK_SUBTRACT,
+	MASK_INTERSECT
+};
+
+struct mask {
+	int      w, h;
+	int      words; // Per row
+	uint64_t *bits; // Bits past `w` in each row are always clear
+};
+
+struct mask *maskNew(int, int);
+void         maskResize(struct mask *, int, int);
+void         maskFree(struct mask *);
+void         maskClear(struct mask *);
+void         maskFill(struct mask *);
+void         maskRect(struct mask *, int, int, int, int);
+void         maskCombine(struct mask *, const struct mask *, enum maskop);
+void         maskInvert(struct mask *);
+bool         maskGet(const struct mask *, int, int);
+size_t       maskCount(const struct mask *);
+bool         maskEmpty(const struct mask *);
+bool         maskBounds(const struct mask *, int *, int *, int *, int *);
+int          maskSpan(const struct mask *, int, int *, int);
+void         maskColor(struct mask *, const struct rgba *, struct rgba, int);
+void         maskFlood(struct mask *, const struct rgba *, int, int, int);
@@ -0,0 +1,255 @@
+//
+// page.c
+// sparse pixel pages
+//
+// A page holds the pixels of one frame of one layer, split into tiles of
+// PAGE_TILE² pixels. Tiles that are fully transparent aren't allocated:
+// reads see transparent pixels there, and the first write that isn't
+// transparent allocates the tile. Tiles that become transparent again are
+// released by `pageCompact`, so memory follows the painted area rather than
+// the size of the sheet.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "color.h"
+#include "blend.h"
+#include "page.h"
+
+#define TILE_PIXELS (PAGE_TILE * PAGE_TILE)
+
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+//
+// Call `body` for every tile `t` at column `tx`, row `ty` that intersects
+// the rectangle `x, y, w, h`, with the intersection in `x0, y0, x1, y1`.
+//
+#define FOR_TILES(p, x, y, w, h, body) \
+	for (int ty = (y) / PAGE_TILE; ty * PAGE_TILE < (y) + (h); ty++) { \
+		for (int tx = (x) / PAGE_TILE; tx * PAGE_TILE < (x) + (w); tx++) { \
+			int x0 = max((x), tx * PAGE_TILE), x1 = min((x) + (w), (tx + 1) * PAGE_TILE), \
+			    y0 = max((y), ty * PAGE_TILE), y1 = min((y) + (h), (ty + 1) * PAGE_TILE), \
+			    i  = ty * (p)->cols + tx; \
+			(void)x0; (void)x1; (void)y0; (void)y1; \
+			body \
+		} \
+	}
+
+static bool transparent(const struct rgba *pixels, int n)
+{
+	uint8_t a = 0;
+
+	for (int i = 0; i < n; i++) {
+		a |= pixels[i].a;
+	}
+	return a == 0;
+}
+
+static struct rgba *tileAlloc(struct page *p, int i)
+{
+	if (!p->tiles[i]) {
+		p->tiles[i] = calloc(TILE_PIXELS, sizeof(struct rgba));
+		p->ntiles++;
+	}
+	p->touched[i] = 1;
+
+	return p->tiles[i];
+}
+
+struct page *pageNew(int w, int h)
+{
+	struct page *p = malloc(sizeof(*p));
+
+	p->w       = w;
+	p->h       = h;
+	p->cols    = (w + PAGE_TILE - 1) / PAGE_TILE;
+	p->rows    = (h + PAGE_TILE - 1) / PAGE_TILE;
+	p->ntiles  = 0;
+	p->tiles   = calloc(p->cols * p->rows, sizeof(*p->tiles));
+	p->touched = calloc(p->cols * p->rows, sizeof(*p->touched));
+
+	return p;
+}
+
+struct page *pageCopy(const struct page *src)
+{
+	struct page *p = pageNew(src->w, src->h);
+
+	for (int i = 0; i < p->cols * p->rows; i++) {
+		if (src->tiles[i]) {
+			p->tiles[i] = malloc(TILE_PIXELS * sizeof(struct rgba));
+			memcpy(p->tiles[i], src->tiles[i], TILE_PIXELS * sizeof(struct rgba));
+		}
+	}
+	p->ntiles = src->ntiles;
+
+	return p;
+}
+
+void pageFree(struct page *p)
+{
+	if (!p)
+		return;
+
+	for (int i = 0; i < p->cols * p->rows; i++) {
+		free(p->tiles[i]);
+	}
+	free(p->tiles);
+	free(p->touched);
+	free(p);
+}
+
+//
+// Return a pointer to pixel `x, y`, for writing up to `*n` pixels, which is
+// set to the number left in the row of its tile. If the tile is transparent,
+// it is allocated if `alloc` is set, or else NULL is returned.
+//
+struct rgba *pageSpan(struct page *p, int x, int y, int *n, bool alloc)
+{
+	int i = (y / PAGE_TILE) * p->cols + x / PAGE_TILE;
+
+	*n = PAGE_TILE - x % PAGE_TILE;
+
+	if (!p->tiles[i] && !alloc)
+		return NULL;
+
+	return &tileAlloc(p, i)[(y % PAGE_TILE) * PAGE_TILE + x % PAGE_TILE];
+}
+
+//
+// Return a pointer to pixel `x, y` for reading, in rows of PAGE_TILE pixels,
+// or NULL if its tile is transparent.
+//
+const struct rgba *pageAt(const struct page *p, int x, int y)
+{
+	const struct rgba *t = p->tiles[(y / PAGE_TILE) * p->cols + x / PAGE_TILE];
+
+	return t ? &t[(y % PAGE_TILE) * PAGE_TILE + x % PAGE_TILE] : NULL;
+}
+
+//
+// Whether the rectangle `x, y, w, h` only covers transparent tiles.
+//
+bool pageEmpty(const struct page *p, int x, int y, int w, int h)
+{
+	if (!p || !p->ntiles)
+		return true;
+
+	FOR_TILES(p, x, y, w, h, {
+		if (p->tiles[i])
+			return false;
+	})
+	return true;
+}
+
+//
+// Copy the rectangle `x, y, w, h` of the page to `out`, which has rows of
+// `stride` pixels.
+//
+void pageRead(const struct page *p, int x, int y, int w, int h, struct rgba *out, int stride)
+{
+	FOR_TILES(p, x, y, w, h, {
+		const struct rgba *t = p->tiles[i];
+
+		for (int r = y0; r < y1; r++) {
+			struct rgba *dst = &out[(r - y) * stride + x0 - x];
+
+			if (t)
+				memcpy(dst, &t[(r - ty * PAGE_TILE) * PAGE_TILE + x0 - tx * PAGE_TILE], (x1 - x0) * sizeof(*dst));
+			else
+				memset(dst, 0, (x1 - x0) * sizeof(*dst));
+		}
+	})
+}
+
+//
+// Copy `in`, which has rows of `stride` pixels, to the rectangle `x, y, w, h`
+// of the page. Transparent pixels written to transparent tiles don't
+// allocate them.
+//
+void pageWrite(struct page *p, int x, int y, int w, int h, const struct rgba *in, int stride)
+{
+	FOR_TILES(p, x, y, w, h, {
+		if (!p->tiles[i]) {
+			bool empty = true;
+
+			for (int r = y0; r < y1 && empty; r++) {
+				empty = transparent(&in[(r - y) * stride + x0 - x], x1 - x0);
+			}
+			if (empty)
+				continue;
+		}
+		struct rgba *t = tileAlloc(p, i);
+
+		for (int r = y0; r < y1; r++) {
+			memcpy(&t[(r - ty * PAGE_TILE) * PAGE_TILE + x0 - tx * PAGE_TILE],
+			       &in[(r - y) * stride + x0 - x], (x1 - x0) * sizeof(*t));
+		}
+	})
+}
+
+//
+// Blend the rectangle `x, y, w, h` of the page onto `out`, which has rows of
+// `stride` pixels. Transparent tiles are skipped.
+//
+void pageBlend(const struct page *p, int x, int y, int w, int h, struct rgba *out, int stride, enum blend mode, int opacity)
+{
+	if (!p->ntiles)
+		return;
+
+	FOR_TILES(p, x, y, w, h, {
+		const struct rgba *t = p->tiles[i];
+
+		for (int r = y0; t && r < y1; r++) {
+			blendSpan(&out[(r - y) * stride + x0 - x],
+			          &t[(r - ty * PAGE_TILE) * PAGE_TILE + x0 - tx * PAGE_TILE], x1 - x0, mode, opacity);
+		}
+	})
+}
+
+//
+// Blend all of `src` onto `dst`, which must be the same size.
+//
+void pageBlendPage(struct page *dst, const struct page *src, enum blend mode, int opacity)
+{
+	for (int i = 0; i < src->cols * src->rows; i++) {
+		if (src->tiles[i])
+			blendSpan(tileAlloc(dst, i), src->tiles[i], TILE_PIXELS, mode, opacity);
+	}
+}
+
+//
+// Release the tiles written to since the last call that are now fully
+// transparent. Returns the number of tiles released.
+//
+int pageCompact(struct page *p)
+{
+	int released = 0;
+
+	for (int i = 0; i < p->cols * p->rows; i++) {
+		if (!p->touched[i])
+			continue;
+
+		p->touched[i] = 0;
+
+		if (p->tiles[i] && transparent(p->tiles[i], TILE_PIXELS)) {
+			free(p->tiles[i]);
+			p->tiles[i] = NULL;
+			p->ntiles--;
+			released++;
+		}
+	}
+	return released;
+}
+
+size_t pageBytes(const struct page *p)
+{
+	if (!p)
+		return 0;
+
+	return sizeof(*p) + p->cols * p->rows * (sizeof(*p->tiles) + sizeof(*p->touched)) +
+	       (size_t)p->ntiles * TILE_PIXELS * sizeof(struct rgba);
+}
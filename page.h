@@ -0,0 +1,26 @@
+//
+// page.h
+// sparse pixel pages
+//
+#define PAGE_TILE 64
+
+struct page {
+	int         w, h;
+	int         cols, rows; // Tiles across and down
+	int         ntiles;     // Tiles allocated
+	struct rgba **tiles;    // PAGE_TILE² pixels each, or NULL where transparent
+	uint8_t     *touched;   // Tiles written to since the last `pageCompact`
+};
+
+struct page *pageNew(int, int);
+struct page *pageCopy(const struct page *);
+void         pageFree(struct page *);
+struct rgba *pageSpan(struct page *, int, int, int *, bool);
+const struct rgba *pageAt(const struct page *, int, int);
+bool         pageEmpty(const struct page *, int, int, int, int);
+void         pageRead(const struct page *, int, int, int, int, struct rgba *, int);
+void         pageWrite(struct page *, int, int, int, int, const struct rgba *, int);
+void         pageBlend(const struct page *, int, int, int, int, struct rgba *, int, enum blend, int);
+void         pageBlendPage(struct page *, const struct page *, enum blend, int);
+int          pageCompact(struct page *);
+size_t       pageBytes(const struct page *);
@@ -0,0 +1,11 @@
+//
+// palette.h
+// palette files and nearest color search
+//
+struct nearest;
+
+struct rgba    *paletteLoad(const char *path, int *n);
+struct nearest *nearestBuild(const struct rgba *colors, int n);
+int             nearestIndex(struct nearest *, struct rgba);
+void            nearestRemap(struct nearest *, struct rgba *, int, int, int);
+void            nearestFree(struct nearest *);
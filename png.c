@@ -0,0 +1,567 @@
+//
+// png.c
+// PNG images
+//
+// Any PNG can be decoded, to 8-bit RGBA: all color types and bit depths,
+// palettes, transparency and interlacing. Images are encoded as 8-bit RGB,
+// or RGBA if any pixel isn't opaque. Each row is filtered with the filter
+// giving the smallest sum of absolute differences; below level 4, only the
+// cheap filters are tried. The image ID is kept in a "Comment" text chunk.
+//
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "deflate.h"
+#include "png.h"
+
+#define PNG_MAX_SIZE 32768
+
+static const uint8_t signature[8] = {137, 'P', 'N', 'G', '\r', '\n', 26, '\n'};
+
+// CRC-32 of each byte value, with the polynomial used by PNG and zlib
+static const uint32_t crcTable[256] = {
+	0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
+	0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+	0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
+	0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+	0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
+	0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+	0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
+	0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+	0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
+	0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+	0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
+	0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+	0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
+	0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+	0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
+	0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+	0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
+	0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+	0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
+	0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+	0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
+	0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
+	0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
+	0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+	0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
+	0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+	0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
+	0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+	0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
+	0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+	0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
+	0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+	0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
+	0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
+	0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
+	0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+	0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
+	0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+	0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
+	0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+	0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
+	0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+	0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+};
+
+static uint32_t crc32(uint32_t crc, const uint8_t *p, size_t n)
+{
+	crc = ~crc;
+
+	while (n--)
+		crc = crcTable[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+
+	return ~crc;
+}
+
+static inline uint32_t be32(const uint8_t *p)
+{
+	return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static inline int paeth(int a, int b, int c)
+{
+	int pa = abs(b - c), pb = abs(a - c), pc = abs(a + b - 2 * c);
+
+	return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+}
+
+//
+// Undo the filter of a row of `n` bytes, given the previous row, which is
+// all zeroes for the first row.
+//
+static int unfilter(uint8_t *row, const uint8_t *prev, int n, int bpp, int filter)
+{
+	switch (filter) {
+	case 0:
+		break;
+	case 1:
+		for (int i = bpp; i < n; i++)
+			row[i] += row[i - bpp];
+		break;
+	case 2:
+		for (int i = 0; i < n; i++)
+			row[i] += prev[i];
+		break;
+	case 3:
+		for (int i = 0; i < n; i++)
+			row[i] += ((i >= bpp ? row[i - bpp] : 0) + prev[i]) / 2;
+		break;
+	case 4:
+		for (int i = 0; i < n; i++)
+			row[i] += paeth(i >= bpp ? row[i - bpp] : 0, prev[i], i >= bpp ? prev[i - bpp] : 0);
+		break;
+	default:
+		return -1;
+	}
+	return 0;
+}
+
+struct header {
+	int      width, height;
+	int      depth, type, interlace;
+	int      channels;
+	uint8_t  palette[256][4];
+	int      trns;     // Whether a transparent color is set
+	uint16_t key[3];   // Transparent color, for types 0 and 2
+};
+
+//
+// Return sample `i` of a row with samples of `depth` bits, scaled to 8 bits,
+// or as is for palette indices.
+//
+static inline int sample(const struct header *h, const uint8_t *row, int i, int *raw)
+{
+	switch (h->depth) {
+	case 16:
+		*raw = row[i * 2] << 8 | row[i * 2 + 1];
+		return row[i * 2];
+	case 8:
+		*raw = row[i];
+		return row[i];
+	default: {
+			int shift = 8 - h->depth - (i * h->depth) % 8;
+
+			*raw = (row[i * h->depth / 8] >> shift) & ((1 << h->depth) - 1);
+			return h->type == 3 ? *raw : *raw * 255 / ((1 << h->depth) - 1);
+		}
+	}
+}
+
+static void convertRow(const struct header *h, const uint8_t *row, int n, uint8_t (*out)[4], int step)
+{
+	for (int x = 0; x < n; x++, out += step) {
+		int v[4], raw[4];
+
+		for (int c = 0; c < h->channels; c++)
+			v[c] = sample(h, row, x * h->channels + c, &raw[c]);
+
+		uint8_t *o = *out;
+
+		switch (h->type) {
+		case 0:
+			o[0] = o[1] = o[2] = v[0];
+			o[3] = h->trns && raw[0] == h->key[0] ? 0 : 255;
+			break;
+		case 2:
+			o[0] = v[0];
+			o[1] = v[1];
+			o[2] = v[2];
+			o[3] = h->trns && raw[0] == h->key[0] && raw[1] == h->key[1] && raw[2] == h->key[2] ? 0 : 255;
+			break;
+		case 3:
+			memcpy(o, h->palette[v[0]], 4);
+			break;
+		case 4:
+			o[0] = o[1] = o[2] = v[0];
+			o[3] = v[1];
+			break;
+		case 6:
+			o[0] = v[0];
+			o[1] = v[1];
+			o[2] = v[2];
+			o[3] = v[3];
+			break;
+		}
+	}
+}
+
+//
+// Unfilter the decompressed image data, and convert it to RGBA. Interlaced
+// images are made of seven passes, each a smaller image of its own.
+//
+static int decodePixels(const struct header *h, uint8_t *raw, uint32_t *data)
+{
+	static const int adam7[7][4] = { // x0, y0, dx, dy
+		{0, 0, 8, 8}, {4, 0, 8, 8}, {0, 4, 4, 8}, {2, 0, 4, 4},
+		{0, 2, 2, 4}, {1, 0, 2, 2}, {0, 1, 1, 2}
+	};
+	int bits = h->depth * h->channels,
+	    bpp  = bits < 8 ? 1 : bits / 8,
+	    npasses = h->interlace ? 7 : 1;
+
+	for (int p = 0; p < npasses; p++) {
+		int x0 = h->interlace ? adam7[p][0] : 0, y0 = h->interlace ? adam7[p][1] : 0,
+		    dx = h->interlace ? adam7[p][2] : 1, dy = h->interlace ? adam7[p][3] : 1,
+		    w  = (h->width - x0 + dx - 1) / dx,
+		    rh = (h->height - y0 + dy - 1) / dy,
+		    stride = (w * bits + 7) / 8;
+
+		if (w <= 0 || rh <= 0)
+			continue;
+
+		uint8_t *prev = calloc(stride, 1);
+
+		for (int y = 0; y < rh; y++, raw += stride + 1) {
+			if (unfilter(raw + 1, prev, stride, bpp, raw[0]) != 0) {
+				free(prev);
+				return -1;
+			}
+			memcpy(prev, raw + 1, stride);
+
+			convertRow(h, raw + 1, w, (uint8_t (*)[4])&data[(y0 + y * dy) * h->width + x0], dx);
+		}
+		free(prev);
+	}
+	return 0;
+}
+
+static size_t rawSize(const struct header *h)
+{
+	static const int adam7[7][4] = {
+		{0, 0, 8, 8}, {4, 0, 8, 8}, {0, 4, 4, 8}, {2, 0, 4, 4},
+		{0, 2, 2, 4}, {1, 0, 2, 2}, {0, 1, 1, 2}
+	};
+	int bits = h->depth * h->channels;
+	size_t size = 0;
+
+	if (!h->interlace)
+		return (size_t)h->height * ((h->width * bits + 7) / 8 + 1);
+
+	for (int p = 0; p < 7; p++) {
+		int w  = (h->width - adam7[p][0] + adam7[p][2] - 1) / adam7[p][2],
+		    rh = (h->height - adam7[p][1] + adam7[p][3] - 1) / adam7[p][3];
+
+		if (w > 0 && rh > 0)
+			size += (size_t)rh * ((w * bits + 7) / 8 + 1);
+	}
+	return size;
+}
+
+static uint8_t *readFile(const char *path, size_t *n)
+{
+	FILE *fp = fopen(path, "rb");
+
+	if (!fp)
+		return NULL;
+
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	uint8_t *buf = size >= 0 ? malloc(size ? size : 1) : NULL;
+
+	if (!buf || fread(buf, 1, size, fp) != (size_t)size) {
+		free(buf);
+		fclose(fp);
+		errno = EIO;
+		return NULL;
+	}
+	fclose(fp);
+	*n = size;
+
+	return buf;
+}
+
+//
+// Decode the `n` bytes of PNG file at `file`. Returns NULL with `errno` set
+// to EINVAL if they aren't a valid PNG.
+//
+struct png *pngRead(const uint8_t *file, size_t n)
+{
+	size_t pos = 8, idatlen = 0, idatcap = 0;
+	uint8_t *idat = NULL, *raw = NULL;
+	struct header h = { .width = 0 };
+	struct png *png = NULL;
+	int valid = 0;
+
+	if (n < 8 || memcmp(file, signature, 8))
+		goto done;
+
+	for (int c = 0; c < 256; c++) {
+		h.palette[c][0] = h.palette[c][1] = h.palette[c][2] = 0;
+		h.palette[c][3] = 255;
+	}
+	png = calloc(1, sizeof(*png));
+
+	for (;;) {
+		if (n - pos < 12)
+			goto done;
+
+		uint32_t len = be32(file + pos);
+		const uint8_t *type = file + pos + 4, *d = type + 4;
+
+		if (len > n - pos - 12 || crc32(0, type, len + 4) != be32(d + len))
+			goto done;
+
+		if (!memcmp(type, "IHDR", 4) && len == 13) {
+			static const int channels[7] = {1, 0, 3, 1, 2, 0, 4};
+
+			h.width     = be32(d);
+			h.height    = be32(d + 4);
+			h.depth     = d[8];
+			h.type      = d[9];
+			h.interlace = d[12];
+
+			if (h.type > 6 || !channels[h.type] || d[10] || d[11] || h.interlace > 1)
+				goto done;
+			if (h.width <= 0 || h.height <= 0 || h.width > PNG_MAX_SIZE || h.height > PNG_MAX_SIZE)
+				goto done;
+			if (h.depth != 8 && h.depth != 16 && (h.type == 2 || h.type >= 4))
+				goto done;
+			if (h.depth != 1 && h.depth != 2 && h.depth != 4 && h.depth != 8 && h.depth != (h.type == 3 ? 8 : 16))
+				goto done;
+
+			h.channels = channels[h.type];
+		} else if (!memcmp(type, "PLTE", 4)) {
+			for (uint32_t i = 0; i < len / 3 && i < 256; i++)
+				memcpy(h.palette[i], d + i * 3, 3);
+		} else if (!memcmp(type, "tRNS", 4)) {
+			if (h.type == 3) {
+				for (uint32_t i = 0; i < len && i < 256; i++)
+					h.palette[i][3] = d[i];
+			} else if (len >= 2 * (h.type == 2 ? 3 : 1)) {
+				for (int i = 0; i < (h.type == 2 ? 3 : 1); i++)
+					h.key[i] = d[i * 2] << 8 | d[i * 2 + 1];
+			}
+			h.trns = 1;
+		} else if (!memcmp(type, "tEXt", 4)) {
+			const uint8_t *nul = memchr(d, 0, len);
+			size_t klen = nul ? (size_t)(nul - d) : len;
+
+			if (nul && klen == sizeof("Comment") - 1 && !memcmp(d, "Comment", klen)) {
+				size_t tlen = len - klen - 1 < sizeof(png->id) - 1 ? len - klen - 1 : sizeof(png->id) - 1;
+
+				memcpy(png->id, d + klen + 1, tlen);
+				png->id[tlen] = '\0';
+			}
+		} else if (!memcmp(type, "IDAT", 4)) {
+			if (idatlen + len > idatcap) {
+				idatcap = idatlen + len > 2 * idatcap ? idatlen + len : 2 * idatcap;
+				idat = realloc(idat, idatcap);
+			}
+			memcpy(idat + idatlen, d, len);
+			idatlen += len;
+		} else if (!memcmp(type, "IEND", 4)) {
+			break;
+		} else if (!(type[0] & 0x20)) { // Unknown critical chunk
+			goto done;
+		}
+		pos += len + 12;
+	}
+	if (!h.width || !idat)
+		goto done;
+
+	size_t size = rawSize(&h);
+
+	raw = malloc(size);
+	png->width  = h.width;
+	png->height = h.height;
+	png->depth  = h.type >= 4 || h.trns ? 32 : 24;
+	png->data   = malloc((size_t)h.width * h.height * sizeof(*png->data));
+
+	if (deflateDecode(idat, idatlen, raw, size) != 0 || decodePixels(&h, raw, png->data) != 0)
+		goto done;
+
+	valid = 1;
+done:
+	if (!valid) {
+		if (png)
+			free(png->data);
+		free(png);
+		png = NULL;
+		errno = EINVAL;
+	}
+	free(raw);
+	free(idat);
+
+	return png;
+}
+
+//
+// Decode the PNG at `path`. Returns NULL with `errno` set if the file can't
+// be read, or EINVAL if it isn't a valid PNG.
+//
+struct png *pngDecode(const char *path)
+{
+	size_t n;
+	uint8_t *file = readFile(path, &n);
+	struct png *png;
+
+	if (!file)
+		return NULL;
+
+	png = pngRead(file, n);
+	free(file);
+
+	return png;
+}
+
+static void writeChunk(FILE *fp, const char *type, const uint8_t *data, size_t len)
+{
+	uint8_t be[4] = {len >> 24, len >> 16, len >> 8, len};
+	uint32_t crc = crc32(crc32(0, (const uint8_t *)type, 4), data, len);
+
+	fwrite(be, 1, 4, fp);
+	fwrite(type, 1, 4, fp);
+
+	if (len)
+		fwrite(data, 1, len, fp);
+
+	be[0] = crc >> 24;
+	be[1] = crc >> 16;
+	be[2] = crc >> 8;
+	be[3] = crc;
+	fwrite(be, 1, 4, fp);
+}
+
+//
+// Filter a row of `n` bytes with the first `nfilters` filters in turn, and
+// write the one with the smallest sum of absolute differences to `out`,
+// after its type. A row that filters to all zeroes can't do any better.
+//
+static void filterRow(const uint8_t *row, const uint8_t *prev, int n, int bpp, int nfilters, uint8_t *out, uint8_t *tmp)
+{
+	unsigned best = ~0u;
+	uint8_t *cand = out + 1, *winner = NULL;
+
+#define SUM(v) (sum += (int8_t)(cand[i] = (v)) < 0 ? 256 - cand[i] : cand[i])
+
+	for (int f = 0; f < nfilters && best; f++) {
+		unsigned sum = 0;
+		int i = 0;
+
+		switch (f) {
+		case 0:
+			for (; i < n; i++)
+				SUM(row[i]);
+			break;
+		case 1:
+			for (; i < bpp; i++)
+				SUM(row[i]);
+			for (; i < n; i++)
+				SUM(row[i] - row[i - bpp]);
+			break;
+		case 2:
+			for (; i < n; i++)
+				SUM(row[i] - prev[i]);
+			break;
+		case 3:
+			for (; i < bpp; i++)
+				SUM(row[i] - prev[i] / 2);
+			for (; i < n; i++)
+				SUM(row[i] - (row[i - bpp] + prev[i]) / 2);
+			break;
+		case 4:
+			for (; i < bpp; i++)
+				SUM(row[i] - prev[i]);
+			for (; i < n; i++)
+				SUM(row[i] - paeth(row[i - bpp], prev[i], prev[i - bpp]));
+			break;
+		}
+		// Filter into whichever buffer doesn't hold the best row so far.
+		if (sum < best) {
+			best   = sum;
+			out[0] = f;
+			winner = cand;
+			cand   = cand == tmp ? out + 1 : tmp;
+		}
+	}
+#undef SUM
+	if (winner != out + 1)
+		memcpy(out + 1, winner, n);
+}
+
+//
+// Write the `w * h` RGBA pixels `data` to `fp`, compressed at `level`
+// (0-9). Returns non-zero on error.
+//
+int pngWrite(FILE *fp, uint32_t *data, int w, int h, int level, const char *id)
+{
+	const uint8_t *px = (const uint8_t *)data;
+	int channels = 3;
+
+	for (size_t i = 0; i < (size_t)w * h; i++) {
+		if (px[i * 4 + 3] != 255) {
+			channels = 4;
+			break;
+		}
+	}
+	int stride = w * channels,
+	    nfilters = level < 4 ? 3 : 5; // Average and Paeth are slow, and rarely help sprites
+	uint8_t *filtered = malloc((size_t)(stride + 1) * h),
+	        *rows     = calloc(3 * stride, 1),
+	        *tmp      = rows + 2 * stride;
+	const uint8_t *prev = rows;
+
+	// RGBA rows are filtered in place, RGB rows are packed first.
+	for (int y = 0; y < h; y++) {
+		const uint8_t *row = px + (size_t)y * w * 4;
+
+		if (channels == 3) {
+			uint8_t *packed = prev == rows ? rows + stride : rows;
+
+			for (int x = 0; x < w; x++)
+				memcpy(packed + x * 3, row + x * 4, 3);
+
+			row = packed;
+		}
+		filterRow(row, prev, stride, channels, nfilters, filtered + (size_t)y * (stride + 1), tmp);
+		prev = row;
+	}
+	free(rows);
+
+	size_t zlen;
+	uint8_t *z = deflateEncode(filtered, (size_t)(stride + 1) * h, level, &zlen);
+
+	free(filtered);
+
+	uint8_t ihdr[13] = {
+		w >> 24, w >> 16, w >> 8, w,
+		h >> 24, h >> 16, h >> 8, h,
+		8, channels == 4 ? 6 : 2, 0, 0, 0
+	};
+	fwrite(signature, 1, sizeof(signature), fp);
+	writeChunk(fp, "IHDR", ihdr, sizeof(ihdr));
+
+	if (id && *id) {
+		size_t len = strlen(id);
+		uint8_t *text = malloc(sizeof("Comment") + len);
+
+		memcpy(text, "Comment", sizeof("Comment"));
+		memcpy(text + sizeof("Comment"), id, len);
+		writeChunk(fp, "tEXt", text, sizeof("Comment") + len);
+		free(text);
+	}
+	writeChunk(fp, "IDAT", z, zlen);
+	writeChunk(fp, "IEND", NULL, 0);
+	free(z);
+
+	return ferror(fp) != 0;
+}
+
+int pngEncode(uint32_t *data, int w, int h, int level, const char *id, const char *path)
+{
+	FILE *fp = fopen(path, "wb");
+
+	if (!fp)
+		return 1;
+
+	int err = pngWrite(fp, data, w, h, level, id);
+
+	return (fclose(fp) != 0) | err;
+}
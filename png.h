@@ -0,0 +1,16 @@
+//
+// png.h
+// PNG images
+//
+struct png {
+	int      width;
+	int      height;
+	int      depth;   // 24 or 32
+	uint32_t *data;   // RGBA
+	char     id[256]; // Comment text, NUL-terminated
+};
+
+struct png *pngDecode(const char *path);
+struct png *pngRead(const uint8_t *file, size_t n);
+int         pngEncode(uint32_t *data, int w, int h, int level, const char *id, const char *path);
+int         pngWrite(FILE *fp, uint32_t *data, int w, int h, int level, const char *id);
@@ -16,40 +16,139 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include <math.h>
 #include <errno.h>
 #include <time.h>
+#include <pthread.h>
 
 #include "color.h"
 #include "texture.h"
+#include "blend.h"
+#include "transform.h"
+#include "mask.h"
+#include "page.h"
+#include "atlas.h"
+#include "raster.h"
 #include "px.h"
 #include "tga.h"
+#include "png.h"
+#include "palette.h"
+#include "latency.h"
+#include "cmd.h"
+#include "journal.h"
+#include "spill.h"
+#include "tiles.h"
+#include "history.h"
+#include "shader.h"
+#include "adjust.h"
 #include "glyphs.h"
 
+#if PAGE_TILE % TILE_SIZE
+#error "history tiles must not straddle page tiles"
+#endif
+
 #define PX_NAME "px"
 #define PX_MAX_LOG_SIZE 128
 #define LENGTH(x) (sizeof(x) / sizeof(x[0]))
 
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+#define TAU 6.28318530717958647692
+
 // Glyph height & width
 #define GH 14
 #define GW 8
 
+// Size of the square regions the canvas is drawn in, each its own texture
+#define RENDER_TILE 256
+
+// Frame slots the background pass compacts per frame
+#define COMPACT_SLOTS 8
+
+// Compression level of saved PNGs, from 0 to 9
+#define PNG_LEVEL 6
+
+// Smallest side of palette swatches before they wrap into a new column
+#define PALETTE_MIN_SIZE 8
+
+// Time each frame may spend on commands from the command socket, in seconds
+#define COMMAND_BUDGET 0.008
+
+// Pixels a "get" or "set" command may carry, at most: 32MB of hex text
+#define COMMAND_PIXELS (1 << 22)
+
+// Transparent pixels between frames in exported atlases
+#define ATLAS_PADDING 1
+
+// Largest difference in any channel for the wand to select a pixel
+#define WAND_TOLERANCE 0
+
+// Copies of each stamp made by radial symmetry, at first and at most
+#define SYMMETRY_FOLDS     6
+#define SYMMETRY_MAX_FOLDS 16
+
+// Composite squares of a loaded sheet built per frame, past the visible ones
+#define WARM_SQUARES 4
+
+// Seconds between frames while the image is loading
+#define LOAD_POLL 0.05
+
+// Megabytes of memory to use before undo states are paged out to disk,
+// unless PX_MEMORY says otherwise. 0 means no limit.
+#define MEMORY_BUDGET 1024
+
+// Largest sheet across or down, with its layers stacked, in pixels: the
+// most that TGA files can hold
+#define SHEET_MAX SHRT_MAX
+
 #define point(x, y)      ((struct point){(x), (y)})
+#define rect(x0, y0, x1, y1) ((struct rect){(x0), (y0), (x1), (y1)})
+#define NORECT           rect(0, 0, 0, 0)
 #define rgba(r, g, b, a) ((struct rgba){r, g, b, a})
 #define WHITE            rgba(255, 255, 255, 255)
 #define GREY             rgba(128, 128, 128, 255)
 #define DARKGREY         rgba(64, 64, 64, 255)
+#define BLACK            rgba(0, 0, 0, 255)
 #define TRANSPARENT      rgba(0, 0, 0, 0)
 #define LIGHT            rgba(255, 255, 255, 0)
+#define SELECTED         rgba(64, 160, 255, 96)
 
 static struct rgba *spriteReadPixels(struct sprite *s);
+static bool spriteReserve(struct sprite *s, int n);
+static bool spriteResize(struct sprite *s, int fw, int fh);
+static bool spriteVisibleRect(struct sprite *s, struct point *lo, struct point *hi);
+static bool spriteWithinBoundary(struct sprite *s, int x, int y);
+static int *frameOrder(int n);
 static void paletteAddColor(int x, int y, struct rgba color);
+static void setFgColor(struct rgba color);
 static void boundaryDraw(struct rgba color, int x, int y, int w, int h);
 static void setupPalette();
+static void paletteSet(struct rgba *colors, int n);
 static void createFrame(GLFWwindow *, const union arg *);
+static void insertFrame(GLFWwindow *, const union arg *);
+static void duplicateFrame(GLFWwindow *, const union arg *);
+static void deleteFrame(GLFWwindow *, const union arg *);
+static void moveFrame(GLFWwindow *, const union arg *);
+static void reverseFrames(GLFWwindow *, const union arg *);
+static void frameTransform(GLFWwindow *, const union arg *);
+static void sheetTransform(GLFWwindow *, const union arg *);
+static void remapColors(GLFWwindow *, const union arg *);
+static void addLayer(GLFWwindow *, const union arg *);
+static void deleteLayer(GLFWwindow *, const union arg *);
+static void selectLayer(GLFWwindow *, const union arg *);
+static void toggleLayer(GLFWwindow *, const union arg *);
+static void layerOpacity(GLFWwindow *, const union arg *);
+static void layerBlend(GLFWwindow *, const union arg *);
 static void spriteRenderFrame(struct sprite *s, int frame);
+static void spriteDrawSlot(struct sprite *s, int slot, struct rect r, int x, int y);
+static void spriteDrawRect(struct sprite *s, struct rect r, int x, int y);
+static int symmetryCopies(struct sprite *s, int x, int y, int size, struct point out[SYMMETRY_MAX_FOLDS]);
 static void saveCopy(GLFWwindow *, const union arg *);
 static void save(GLFWwindow *, const union arg *);
+static void export(GLFWwindow *, const union arg *);
+static void exportAtlas(GLFWwindow *, const union arg *);
 static void move(GLFWwindow *, const union arg *);
 static void pan(GLFWwindow *, const union arg *);
 static void onion(GLFWwindow *, const union arg *);
@@ -62,10 +161,157 @@ static void brushSize(GLFWwindow *, const union arg *);
 static void adjustFPS(GLFWwindow *, const union arg *);
 static void brush(GLFWwindow *, const union arg *);
 static void marquee(GLFWwindow *, const union arg *);
+static void wand(GLFWwindow *, const union arg *);
+static void shape(GLFWwindow *, const union arg *);
+static void symmetry(GLFWwindow *, const union arg *);
+static void folds(GLFWwindow *, const union arg *);
+static void selectAll(GLFWwindow *, const union arg *);
+static void invertSelection(GLFWwindow *, const union arg *);
+static void fillSelection(GLFWwindow *, const union arg *);
+static void stats(GLFWwindow *, const union arg *);
+static void printLatency();
+static void latencyRange(char *, struct latencystats *, int, int);
+static void drawLatency();
+static void latency(GLFWwindow *, const union arg *);
+static void fence(GLFWwindow *, const union arg *);
+static void vsync(GLFWwindow *, const union arg *);
+static void grid(GLFWwindow *, const union arg *);
+static void tiling(GLFWwindow *, const union arg *);
+static void adjustUpdate();
+static void adjustCollect(struct sprite *s);
+static bool adjustMissing(struct sprite *s, struct rect r);
+static void preview(GLFWwindow *, const union arg *);
+static void adjustColors(GLFWwindow *, const union arg *);
+static void resetColors(GLFWwindow *, const union arg *);
+static void commitColors(GLFWwindow *, const union arg *);
 
 struct session *session;
 struct palette *palette;
-struct sprite  glyphs;
+struct texture *glyphs;
+struct cmdserver *server;
+
+static const char *symmetryNames[] = {
+	[SYMMETRY_NONE]       = "",
+	[SYMMETRY_HORIZONTAL] = "|",
+	[SYMMETRY_VERTICAL]   = "-",
+	[SYMMETRY_FOUR]       = "+",
+	[SYMMETRY_RADIAL]     = "*",
+};
+
+// Brush stamps to blend in the next batch, and the buffers used to make
+// and blend them, kept from one batch to the next
+struct {
+	struct point *path;   // Points of the stroke
+	struct point *copies; // SYMMETRY_MAX_FOLDS per point of the path
+	struct rect  *rects;  // Stamps
+	struct span  *spans;  // Stamps cut into rows
+	int          *rows;   // Where the spans of each row start and end
+	int          npath, n;
+	int          pcap, ccap, cap, scap, rcap;
+} stamps;
+
+// Startup phases, with --trace-startup
+struct {
+	bool on;
+	int  n;
+	struct phase {
+		const char *name;
+		double     start, end;
+	} phases[16];
+} trace;
+
+// Grid & frame boundary overlay
+struct {
+	GLuint program;
+	GLint  fw, zoom, spacing;
+} overlay;
+
+static const char *overlayVert =
+	"#version 110\n"
+	"varying vec2 pos;\n"
+	"void main() {\n"
+	"	pos = gl_Vertex.xy;\n"
+	"	gl_Position = ftransform();\n"
+	"}\n";
+
+// Everything is computed from the position in the sheet, so the cost is the
+// same whether the sheet has one frame or a thousand.
+static const char *overlayFrag =
+	"#version 110\n"
+	"uniform float fw, zoom, spacing;\n"
+	"varying vec2  pos;\n"
+	"void main() {\n"
+	"	float px = 1.0 / zoom;\n" // One screen pixel, in sheet pixels
+	"	vec4  c  = vec4(0.0);\n"
+	"	if (fract(pos.x) < px || fract(pos.y) < px)\n" // Pixel grid, fading in with the zoom
+	"		c = vec4(0.5, 0.5, 0.5, clamp((zoom - 2.0) / 8.0, 0.0, 0.35));\n"
+	"	if (spacing > 0.0 && (mod(pos.x, spacing) < px || mod(pos.y, spacing) < px))\n"
+	"		c = vec4(0.5, 0.5, 0.5, 0.6);\n"
+	"	if (mod(pos.x, fw) < px)\n"
+	"		c = vec4(0.25, 0.25, 0.25, 1.0);\n"
+	"	gl_FragColor = c;\n"
+	"}\n";
+
+// Color adjustments, previewed by drawing the sheet through the table of
+// what its colors become
+struct {
+	GLuint            program;
+	GLint             n, side;
+	bool              on;
+	struct adjustment params;
+	struct colormap   *map;    // Colors of the layers, or NULL until previewed
+	struct texture    *keys;   // Colors of `map`, in order, `width` across and down
+	struct texture    *values; // What they become
+	int               width;
+	struct sprite     *sprite; // State the colors were collected from
+	int               snapshot;
+	struct tile       **tiles;
+	struct rgba       *palette;
+	int               ncolors;
+	bool              exact;   // Whether the preview shows what committing gives
+} adjust = {.params = {.high = 255}, .exact = true};
+
+static const char *adjustVert =
+	"#version 110\n"
+	"void main() {\n"
+	"	gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+	"	gl_FrontColor  = gl_Color;\n"
+	"	gl_Position    = ftransform();\n"
+	"}\n";
+
+// Each pixel's color is looked up in the sorted keys with a binary search,
+// and replaced by the value at the same place. Colors are compared as 24-bit
+// integers, which floats hold exactly, and texels are fetched at their
+// centers, so the shader copies the same bytes `colormapApply` does. Every
+// fetch is made whether it is needed or not, so that control flow stays
+// uniform.
+static const char *adjustFrag =
+	"#version 110\n"
+	"uniform sampler2D sheet, keys, values;\n"
+	"uniform float n, side;\n"
+	"vec2 at(float i) {\n"
+	"	float y = floor(i / side);\n"
+	"	return vec2(i - y * side + 0.5, y + 0.5) / side;\n"
+	"}\n"
+	"float key(vec3 c) {\n"
+	"	c = floor(c * 255.0 + 0.5);\n"
+	"	return (c.r * 256.0 + c.g) * 256.0 + c.b;\n"
+	"}\n"
+	"void main() {\n"
+	"	vec4  c  = texture2D(sheet, gl_TexCoord[0].st);\n"
+	"	float k  = key(c.rgb), lo = 0.0, hi = n;\n"
+	"	for (int i = 0; i < 17; i++) {\n" // Enough halvings for COLORMAP_MAX colors
+	"		float mid = floor((lo + hi) / 2.0);\n"
+	"		bool  below = key(texture2D(keys, at(mid)).rgb) < k;\n"
+	"		if (lo < hi) {\n"
+	"			if (below) lo = mid + 1.0; else hi = mid;\n"
+	"		}\n"
+	"	}\n"
+	"	vec3 v = texture2D(values, at(lo)).rgb;\n"
+	"	if (c.a > 0.0 && lo < n && key(texture2D(keys, at(lo)).rgb) == k)\n"
+	"		c.rgb = v;\n"
+	"	gl_FragColor = c * gl_Color;\n"
+	"}\n";
 
 #include "config.h"
 
@@ -95,16 +341,44 @@ static void fatal(const char *err, ...)
 	exit(EXIT_FAILURE);
 }
 
+//
+// Record that startup phase `phase` ran from `start` to `end`, in seconds
+// since GLFW was initialized.
+//
+static void traceStartup(const char *phase, double start, double end)
+{
+	if (!trace.on || trace.n == LENGTH(trace.phases))
+		return;
+
+	trace.phases[trace.n] = (struct phase){ phase, start, end };
+	trace.n++;
+}
+
+static void printStartup()
+{
+	if (!trace.on)
+		return;
+
+	debug("startup: %8s %8s  %s", "start", "took", "phase");
+
+	for (int i = 0; i < trace.n; i++) {
+		struct phase *p = &trace.phases[i];
+
+		debug("startup: %6.1fms %6.1fms  %s", p->start * 1000, (p->end - p->start) * 1000, p->name);
+	}
+	trace.on = false;
+}
+
 static void drawGlyph(int glyph, int x, int y)
 {
 	glPushMatrix();
 	glTranslatef(x, y, 0);
 	textureDrawRect(
-		glyphs.texture,
-		(glyph - 32) * (glyphs.fw + 1),
+		glyphs,
+		(glyph - 32) * GW,
 		0,
-		glyphs.fw,
-		glyphs.fh,
+		GW - 1,
+		GH,
 		0, 0
 	);
 	glPopMatrix();
@@ -113,7 +387,7 @@ static void drawGlyph(int glyph, int x, int y)
 static void drawGlyphs(char *str, int x, int y)
 {
 	for (int i = 0; i < strlen(str); i++) {
-		drawGlyph(str[i], x + i * (glyphs.fw + 1), y);
+		drawGlyph(str[i], x + i * GW, y);
 	}
 }
 
@@ -147,694 +421,3741 @@ static void errorCallback(int error, const char* description)
 	fputs(description, stderr);
 }
 
-static void spriteSnapshot(struct sprite *s)
+static inline bool rectEmpty(struct rect r)
 {
-	struct snapshot snap = (struct snapshot){
-		.pixels = spriteReadPixels(s),
-		.x      = 0,
-		.y      = 0,
-		.w      = s->fw * s->nframes,
-		.h      = s->fh
-	};
-	if (s->snapshot < s->nsnapshots - 1) {
-		for (int i = s->snapshot; i < s->nsnapshots; i++) {
-			free(s->snapshots[i].pixels);
-		}
-		s->nsnapshots = s->snapshot + 1;
-	}
-	s->snapshots = realloc(s->snapshots, (s->nsnapshots + 1) * sizeof(*s->snapshots));
-	s->snapshots[s->nsnapshots] = snap;
-	s->nsnapshots++;
-	s->snapshot++;
+	return r.x0 >= r.x1 || r.y0 >= r.y1;
 }
 
-static void spriteFlash(struct sprite *s)
+static struct rect rectUnion(struct rect a, struct rect b)
 {
-	glBindFramebuffer(GL_FRAMEBUFFER, s->fb);
-	glClear(GL_COLOR_BUFFER_BIT);
-	glClearColor(0.75, 0.0, 0.0, 1.0);
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (rectEmpty(a))
+		return b;
+	if (rectEmpty(b))
+		return a;
+
+	return rect(min(a.x0, b.x0), min(a.y0, b.y0), max(a.x1, b.x1), max(a.y1, b.y1));
 }
 
-static void spriteRestoreSnapshot(struct sprite *s, int snapshot)
+static inline bool rectIntersects(struct rect a, struct rect b)
 {
-	s->snapshot = snapshot;
+	return a.x0 < b.x1 && b.x0 < a.x1 && a.y0 < b.y1 && b.y0 < a.y1;
+}
 
-	struct snapshot snap = s->snapshots[snapshot];
+//
+// Return the page of layer `l` for slot `slot`, allocating a blank one if
+// there is none yet. A blank page holds no pixels until it is painted on.
+//
+static struct page *layerPage(struct sprite *s, struct layer *l, int slot)
+{
+	if (!l->pages[slot])
+		l->pages[slot] = pageNew(s->fw, s->fh);
 
-	glBindFramebuffer(GL_FRAMEBUFFER, s->fb);
-	glClear(GL_COLOR_BUFFER_BIT);
-	glClearColor(0.0, 0.0, 0.0, 0.0);
-	glDrawPixels(snap.w, snap.h, GL_RGBA, GL_UNSIGNED_BYTE, snap.pixels);
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	return l->pages[slot];
 }
 
-static void spriteRedo(struct sprite *s)
+static struct layer layerBlank(struct sprite *s)
 {
-	if (s->snapshot == s->nsnapshots - 1) { // Max redos reached
-		spriteFlash(s);
-		return;
-	}
-	spriteRestoreSnapshot(s, s->snapshot + 1);
+	return (struct layer){
+		.pages   = calloc(s->capacity, sizeof(struct page *)),
+		.opacity = 255,
+		.visible = true,
+		.blend   = BLEND_NORMAL
+	};
 }
 
-static void spriteUndo(struct sprite *s)
+static void layerFree(struct sprite *s, struct layer *l)
 {
-	if (s->snapshot == 0) { // Max undos reached
-		spriteFlash(s);
-		return;
+	for (int i = 0; i < s->capacity; i++) {
+		pageFree(l->pages[i]);
 	}
-	spriteRestoreSnapshot(s, s->snapshot - 1);
+	free(l->pages);
 }
 
-static void undo()
+//
+// Copy the layer settings, without the pixels, eg. to keep them with a
+// snapshot.
+//
+static struct layer *spriteLayerProps(struct sprite *s)
 {
-	spriteUndo(session->sprite);
+	struct layer *props = malloc(s->nlayers * sizeof(*props));
+
+	for (int i = 0; i < s->nlayers; i++) {
+		props[i] = s->layers[i];
+		props[i].pages = NULL;
+	}
+	return props;
 }
 
-static void redo()
+//
+// Drop the composite of the layers under the active one. It is rebuilt
+// lazily, a slot at a time.
+//
+static void spriteDropCache(struct sprite *s)
 {
-	spriteRedo(session->sprite);
+	for (int i = 0; i < s->capacity; i++) {
+		pageFree(s->below[i]);
+		s->below[i] = NULL;
+	}
 }
 
-static void spriteResizeFrame(struct sprite *s, int w, int h)
+//
+// Mark the whole composite as out of date, eg. after a layer setting changed.
+//
+static void spriteInvalidate(struct sprite *s)
 {
-	w *= s->nframes;
+	s->damage = rect(0, 0, s->fw * s->nframes, s->fh);
 
-	int stride = w * sizeof(struct rgba);
-	s->pixels = realloc(s->pixels, h * stride);
-
-	memset(s->pixels, 0, h * stride);
-
-	if (s->texture != 0)
-		glDeleteTextures(1, &s->texture->id);
-
-	s->texture = textureGen(w, h, s->pixels);
+	// Squares left over from loading are all composited again.
+	free(s->cold);
+	s->cold = NULL;
 }
 
-static void brush(GLFWwindow *_w, const union arg *_a)
+//
+// Return the composite texture of slot `slot` covering pixel `x, y` of the
+// frame.
+//
+static inline struct texture **spriteTile(struct sprite *s, int slot, int x, int y)
 {
-	session->tool.curr            = TOOL_BRUSH;
-	session->tool.u.brush.size    = +1;
-	session->tool.u.brush.prev.x  = -1;
-	session->tool.u.brush.prev.y  = -1;
-	session->tool.u.brush.curr.x  = -1;
-	session->tool.u.brush.curr.y  = -1;
-	session->tool.u.brush.drawing = false;
-	session->tool.u.brush.color   = TRANSPARENT;
+	return &s->tiles[(slot * s->trows + y / RENDER_TILE) * s->tcols + x / RENDER_TILE];
 }
 
-static struct sprite sprite(int fw, int fh, uint8_t *pixels, int start, int end)
+//
+// Whether the `w * h` pixels at `x, y` of slot `slot` are painted on any
+// visible layer, and need a composite texture.
+//
+static bool spriteTileNeeded(struct sprite *s, int slot, int x, int y, int w, int h)
 {
-	struct sprite s = (struct sprite){
-		.pixels       = pixels,
-		.texture      = 0,
-		.fb           = fbGen(),
-		.dirty        = false,
-		.fw           = fw,
-		.fh           = fh,
-		.nframes      = 0,
-		.snapshot     = -1,
-		.snapshots    = NULL,
-		.nsnapshots   = 0
-	};
-
-	if (!pixels) {
-		spriteResizeFrame(&s, end - start, fh);
-	} else {
-		s.nframes = (end - start) / fw;
-		s.texture = textureGen(end - start, fh, s.pixels);
-		fbAttach(s.fb, s.texture);
+	for (int l = 0; l < s->nlayers; l++) {
+		if (s->layers[l].visible && !pageEmpty(s->layers[l].pages[slot], x, y, w, h))
+			return true;
 	}
-
-	return s;
+	return false;
 }
 
-static struct rgba *spriteReadPixels(struct sprite *s)
+static void spriteClearSlot(struct sprite *s, int slot)
 {
-	struct rgba *tmp = malloc(sizeof(struct rgba) * s->fw * s->nframes * s->fh);
+	for (int l = 0; l < s->nlayers; l++) {
+		pageFree(s->layers[l].pages[slot]);
+		s->layers[l].pages[slot] = NULL;
+	}
+	pageFree(s->below[slot]);
+	s->below[slot] = NULL;
 
-	glBindFramebuffer(GL_FRAMEBUFFER, s->fb);
-	glReadPixels(0, 0, s->fw * s->nframes, s->fh, GL_RGBA, GL_UNSIGNED_BYTE, tmp);
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	for (int i = 0; i < s->tcols * s->trows; i++) {
+		struct texture **t = &s->tiles[slot * s->tcols * s->trows + i];
 
-	return tmp;
+		if (*t)
+			textureDelete(*t);
+		*t = NULL;
+	}
 }
 
-static void createFrame()
+static void spriteCopySlot(struct sprite *s, int src, int dst)
 {
-	struct sprite *s = session->sprite;
-	struct rgba *tmp = spriteReadPixels(s); // Create copy of framebuffer pixels
+	spriteClearSlot(s, dst);
 
-	int w = s->fw * (s->nframes + 1);
-	int stride = w * sizeof(struct rgba);
+	for (int l = 0; l < s->nlayers; l++) {
+		struct layer *ly = &s->layers[l];
 
-	if ((s->pixels = realloc(s->pixels, s->fh * stride)) == NULL) {
-		fatal("couldn't allocate memory");
+		if (ly->pages[src])
+			ly->pages[dst] = pageCopy(ly->pages[src]);
 	}
-	memset(s->pixels, 0, s->fh * stride);
-
-	if (s->texture)
-		glDeleteTextures(1, &s->texture->id);
-
-	s->texture = textureGen(w, s->fh, s->pixels);
-	fbAttach(s->fb, s->texture);
-
-	glBindFramebuffer(GL_FRAMEBUFFER, s->fb);
-	glDrawPixels(s->fw * s->nframes, s->fh, GL_RGBA, GL_UNSIGNED_BYTE, tmp);
-	glBlitFramebuffer(
-		s->fw * (s->nframes - 1), 0,       // Source x0, y0
-		s->fw * s->nframes,       s->fh,   // Source x1, y1
-		s->fw * s->nframes,       0,       // Destination x0, y0
-		s->fw * (s->nframes + 1), s->fh,   // Destination x1, y1
-		GL_COLOR_BUFFER_BIT, GL_NEAREST
-	);
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-	s->nframes++;
-
-	free(tmp);
 }
 
-static void addSprite(struct sprite s)
+//
+// Return the composite of the layers under the active one for slot `slot`,
+// or NULL if the active layer is the bottom one.
+//
+static struct page *spriteBelow(struct sprite *s, int slot)
 {
-	session->sprites = realloc(session->sprites, (session->nsprites + 1) * sizeof(s));
-	session->sprites[session->nsprites] = s;
-	session->sprite = &session->sprites[session->nsprites];
-	session->nsprites++;
-}
+	if (s->layer == 0)
+		return NULL;
 
-static bool loadSprites(char *path)
-{
-	struct tga *t;
-	struct sprite s;
+	if (!s->below[slot]) {
+		struct page *page = pageNew(s->fw, s->fh);
 
-	session->filepath = path;
+		for (int l = 0; l < s->layer; l++) {
+			struct layer *ly = &s->layers[l];
 
-	if ((t = tgaDecode(path)) == NULL) {
-		if (errno == ENOENT) {
-			return false;
-		} else {
-			fatal(" couldn't load image '%s'", path);
+			if (ly->visible && ly->pages[slot])
+				pageBlendPage(page, ly->pages[slot], ly->blend, ly->opacity);
 		}
+		s->below[slot] = page;
 	}
-	s = sprite(t->height, t->height, (uint8_t *)t->data, 0, t->width);
-	s.image = t;
+	return s->below[slot];
+}
 
-	debug("loading image '%s' (%dx%dx%d)\n", path, t->width, t->height, t->depth);
+//
+// Composite the `w * h` pixels at `x, y` of slot `slot` into `out`. Only the
+// active layer and the ones above it are blended: the layers under it come
+// from the cache, so that painting on the top layer costs the same as on a
+// sheet without layers.
+//
+static void spriteComposite(struct sprite *s, int slot, int x, int y, int w, int h, struct rgba *out)
+{
+	struct page *below = spriteBelow(s, slot);
 
-	addSprite(s);
+	if (below)
+		pageRead(below, x, y, w, h, out, w);
+	else
+		memset(out, 0, w * h * sizeof(*out));
 
-	return true;
-}
+	for (int l = s->layer; l < s->nlayers; l++) {
+		struct layer *ly = &s->layers[l];
 
-static bool spriteWithinBoundary(struct sprite *s, int x, int y)
-{
-	return session->x <= x && x < (session->x + s->fw * s->nframes * session->zoom) &&
-		session->y <= y && y < (session->y + s->fh * session->zoom);
+		if (ly->visible && ly->pages[slot])
+			pageBlend(ly->pages[slot], x, y, w, h, out, w, ly->blend, ly->opacity);
+	}
 }
 
-static struct point snap(struct point p)
+//
+// Recomposite the damaged part `r` of the tiled frame into the tiling
+// texture. The texture is made again, whole, when the frame size or the
+// slot at the tiled frame changed.
+//
+static void tilingUpdate(struct sprite *s, struct rect r)
 {
-	return (struct point){
-		.x = p.x - (p.x % session->zoom),
-		.y = p.y - (p.y % session->zoom)
-	};
-}
+	if (!session->tiling)
+		return;
 
-static void drawCursor(GLFWwindow *win, int x, int y, enum tool t)
-{
-	int s = session->tool.u.brush.size * session->zoom;
+	int f    = min(session->tiled, s->nframes - 1),
+	    slot = s->frames[f];
+	struct texture *t = session->tile;
 
-	struct point n = snap(point(x, y));
-	struct sprite *sp = session->sprite;
+	if (!t || t->w != s->fw || t->h != s->fh || session->tiledSlot != slot) {
+		if (t)
+			textureDelete(t);
 
-	switch (t) {
-	case TOOL_BRUSH:
-		if (spriteWithinBoundary(session->sprite, x, y)) {
-			fillRect(n.x, n.y, n.x + s, n.y + s, session->fg);
-		} else {
-			boundaryDraw(GREY, n.x, n.y, n.x + s, n.y + s);
-		}
-		break;
-	case TOOL_SAMPLER:
-		boundaryDraw(WHITE, n.x, n.y, n.x + s, n.y + s);
-		break;
-	case TOOL_MULTI: {
-			int frame = (n.x - session->x) / sp->fw / session->zoom;
-			for (int i = 0; i < sp->nframes - frame; i++) {
-				fillRect(n.x + i * sp->fw * session->zoom,
-						 n.y,
-						 n.x + i * sp->fw * session->zoom + s,
-						 n.y + s, session->fg);
-			}
-		}
-		break;
-	case TOOL_MARQUEE: {
-			struct marquee *m = &session->tool.u.marquee;
-			if (m->state > MARQUEE_NONE && m->max.x != -1 && m->max.y != -1) { // Draw marquee
-				fillRect(m->min.x, m->min.y, m->max.x, m->max.y, LIGHT);
-				glEnable(GL_COLOR_LOGIC_OP);
-				glLogicOp(GL_INVERT);
-				boundaryDraw(GREY, m->min.x, m->min.y, m->max.x, m->max.y);
-				glDisable(GL_COLOR_LOGIC_OP);
-			}
-			if (m->state == MARQUEE_ENDED) {
-				boundaryDraw(WHITE, n.x, n.y, n.x + 1, n.y + 1);
-			} else if (m->state == MARQUEE_CUT) {
-				textureDrawRect(sp->texture, m->min.x, m->min.y, m->max.x, m->max.y, n.x, n.y);
-			}
-			break;
-		}
+		t = session->tile  = textureGen(s->fw, s->fh, NULL);
+		session->tiledSlot = slot;
+		r = rect(f * s->fw, 0, (f + 1) * s->fw, s->fh);
 	}
-}
+	int x0 = max(r.x0, f * s->fw) - f * s->fw,
+	    x1 = min(r.x1, (f + 1) * s->fw) - f * s->fw;
 
-static void spriteDraw(struct sprite *s, int x, int y)
-{
-	x -= session->x;
-	y -= session->y;
+	if (x0 >= x1 || r.y0 >= r.y1)
+		return;
+
+	struct rgba *out = (struct rgba *)textureMap((x1 - x0) * (r.y1 - r.y0) * sizeof(*out));
 
-	x /= session->zoom;
-	y /= session->zoom;
+	spriteComposite(s, slot, x0, r.y0, x1 - x0, r.y1 - r.y0, out);
+	textureUnmap(t, x0, r.y0, x1 - x0, r.y1 - r.y0);
+}
 
-	y += session->tool.u.brush.size;
+//
+// Recomposite the part `r` of the square at `x, y` of slot `slot`, in frame
+// coordinates. A texture is created the first time its square is painted
+// on, and deleted once nothing is painted there anymore.
+//
+static void spriteRefresh(struct sprite *s, int slot, int x, int y, struct rect r)
+{
+	struct texture **t = spriteTile(s, slot, x, y);
+	int w  = min(RENDER_TILE, s->fw - x), h = min(RENDER_TILE, s->fh - y),
+	    x0 = max(x, r.x0), x1 = min(x + w, r.x1),
+	    y0 = max(y, r.y0), y1 = min(y + h, r.y1);
+
+	if (!spriteTileNeeded(s, slot, x, y, w, h)) {
+		if (*t)
+			textureDelete(*t);
+		*t = NULL;
+	} else if (!*t) { // New textures are uploaded whole
+		*t = textureGen(w, h, NULL);
+		x0 = x, x1 = x + w, y0 = y, y1 = y + h;
+	}
+	if (s->cold && (!*t || (x0 == x && y0 == y && x1 == x + w && y1 == y + h)))
+		s->cold[t - s->tiles] = 0;
 
-	y = session->h - y;
+	if (!*t)
+		return;
 
-	// TODO(cloudhead): put this in a function
-	session->tool.u.brush.prev = session->tool.u.brush.curr;
-	session->tool.u.brush.curr.x = x;
-	session->tool.u.brush.curr.y = y;
+	// Composite straight into upload memory, so the pixels are copied once.
+	struct rgba *out = (struct rgba *)textureMap((x1 - x0) * (y1 - y0) * sizeof(*out));
 
-	s->dirty = true;
+	spriteComposite(s, slot, x0, y0, x1 - x0, y1 - y0, out);
+	textureUnmap(*t, x0 - x, y0 - y, x1 - x0, y1 - y0);
 }
 
-static void spritePaint(struct sprite *s, int x, int y, int x1, int y1)
+//
+// Recomposite the part of the composite textures that is out of date.
+//
+static void spriteFlush(struct sprite *s)
 {
-	int size = session->tool.u.brush.size;
+	struct rect r = s->damage;
 
-	if (session->tool.u.brush.drawing > DRAW_STARTED) {
-		int dx = abs(x1 - x);
-		int dy = abs(y1 - y);
-		int sx = x < x1 ? 1 : -1;
-		int sy = y < y1 ? 1 : -1;
-		int err = dx - dy;
+	r.x0 = max(r.x0, 0);
+	r.y0 = max(r.y0, 0);
+	r.x1 = min(r.x1, s->fw * s->nframes);
+	r.y1 = min(r.y1, s->fh);
 
-		for (;;) {
-			glRecti(x, y, x + size, y + size);
+	s->damage = NORECT;
 
-			if (x == x1 && y == y1)
-				break;
+	tilingUpdate(s, r);
 
-			int err2 = err * 2;
+	if (rectEmpty(r))
+		return;
 
-			if (err2 > -dy) {
-				err -= dy;
-				x += sx;
-			}
-			if (x == x1 && y == y1) {
-				glRecti(x, y, x + size, y + size);
-				break;
-			}
-			if (err2 < dx) {
-				err += dx;
-				y += sy;
+	// Colors painted during a stroke must be previewed before it is
+	// snapshotted, so the table is collected again if they are new.
+	if (adjust.on && adjust.map && adjust.sprite == s && adjustMissing(s, r))
+		adjust.sprite = NULL;
+
+	for (int f = r.x0 / s->fw; f * s->fw < r.x1; f++) {
+		int slot = s->frames[f],
+		    fl   = max(r.x0, f * s->fw) - f * s->fw, // Damaged part of the frame,
+		    fr   = min(r.x1, (f + 1) * s->fw) - f * s->fw; // in frame coordinates
+
+		for (int y = r.y0 - r.y0 % RENDER_TILE; y < r.y1; y += RENDER_TILE) {
+			for (int x = fl - fl % RENDER_TILE; x < fr; x += RENDER_TILE) {
+				spriteRefresh(s, slot, x, y, rect(fl, r.y0, fr, r.y1));
 			}
 		}
-	} else {
-		glRecti(x, y, x + size, y + size);
 	}
 }
 
-static void spriteRender(struct sprite *s)
+//
+// Composite the squares left out when the sheet was loaded: the visible
+// ones first, then `WARM_SQUARES` more per frame, in slot order.
+//
+static void spriteWarm(struct sprite *s)
 {
-	if (!s->dirty)
+	int per = s->tcols * s->trows;
+	struct point lo, hi;
+
+	if (!s->cold)
 		return;
 
-	glColor4ubv((GLubyte*)&session->fg);
+	if (spriteVisibleRect(s, &lo, &hi)) {
+		for (int f = lo.x / s->fw; f * s->fw < hi.x; f++) {
+			int slot = s->frames[f],
+			    fl   = max(lo.x, f * s->fw) - f * s->fw,
+			    fr   = min(hi.x, (f + 1) * s->fw) - f * s->fw;
 
-	int x  = session->tool.u.brush.curr.x;
-	int y  = session->tool.u.brush.curr.y;
-	int x1 = session->tool.u.brush.prev.x;
-	int y1 = session->tool.u.brush.prev.y;
+			for (int y = lo.y - lo.y % RENDER_TILE; y < hi.y; y += RENDER_TILE) {
+				for (int x = fl - fl % RENDER_TILE; x < fr; x += RENDER_TILE) {
+					if (s->cold[slot * per + (y / RENDER_TILE) * s->tcols + x / RENDER_TILE])
+						spriteRefresh(s, slot, x, y, rect(0, 0, s->fw, s->fh));
+				}
+			}
+		}
+	}
+	for (int n = 0; n < WARM_SQUARES && s->warm < s->capacity * per; s->warm++) {
+		int i = s->warm % per;
 
-	switch (session->tool.curr) {
-	case TOOL_BRUSH:
-		spritePaint(s, x, y, x1, y1);
-		break;
-	case TOOL_MULTI:
-		for (int i = 0; i < s->nframes; i++) {
-			spritePaint(s, x + i * s->fw, y, x1 + i * s->fw, y1);
+		if (s->cold[s->warm]) {
+			spriteRefresh(s, s->warm / per, i % s->tcols * RENDER_TILE, i / s->tcols * RENDER_TILE,
+			              rect(0, 0, s->fw, s->fh));
+			n++;
 		}
-		break;
-	default:
-		break;
 	}
-	s->dirty = false;
+	if (s->warm == s->capacity * per) {
+		free(s->cold);
+		s->cold = NULL;
+	}
 }
 
-static void spriteRenderFrame(struct sprite *s, int frame)
+//
+// Return the sheet with its layers flattened, in frame order.
+//
+static struct rgba *spriteFlatten(struct sprite *s)
 {
-	textureDrawRect(s->texture, frame * s->fw, 0, s->fw, s->fh, 0, 0);
-}
+	int w = s->fw * s->nframes;
+	struct rgba *pixels = malloc(w * s->fh * sizeof(*pixels)),
+	            *tmp    = malloc(s->fw * s->fh * sizeof(*tmp));
 
-static void spriteRenderCurrentFrame(struct sprite *s)
-{
-	double elapsed = glfwGetTime() - session->started;
-	double frac = session->fps * elapsed;
-	int frame = (int)floor(frac) % s->nframes;
+	for (int f = 0; f < s->nframes; f++) {
+		spriteComposite(s, s->frames[f], 0, 0, s->fw, s->fh, tmp);
 
-	spriteRenderFrame(s, frame);
+		for (int y = 0; y < s->fh; y++) {
+			memcpy(&pixels[y * w + f * s->fw], &tmp[y * s->fw], s->fw * sizeof(*tmp));
+		}
+	}
+	free(tmp);
+
+	return pixels;
 }
 
-static void spriteStartDrawing(struct sprite *s, int x, int y)
+static void spriteJournal(struct sprite *s, struct snapshot *from, struct snapshot *to)
 {
-	if (!spriteWithinBoundary(s, x, y))
+	struct rgba *pixels;
+	int rect[4];
+
+	if (!session->journal)
 		return;
 
-	spriteDraw(s, x, y);
-	session->tool.u.brush.drawing = DRAW_STARTED;
-}
+	// Sheets with differently sized frames differ everywhere.
+	bool resized = from->fw != to->fw || from->fh != to->fh;
 
-static void spriteStopDrawing(struct sprite *s)
-{
-	session->tool.u.brush.drawing = DRAW_ENDED;
-	spriteSnapshot(s);
-}
+	if (!tilesDiff(resized ? NULL : from->tiles, from->ntiles, to->tiles, to->ntiles, to->w, to->h, to->fw, to->fh, rect))
+		return;
 
-static struct rgba sample(int x, int y)
-{
-	struct rgba pixel;
-	glReadPixels(x, session->h - y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &pixel);
-	return pixel;
+	if (journalCompactDue(session->journal, rect, to->w, to->h)) {
+		pixels = malloc(to->w * to->h * sizeof(*pixels));
+		tilesToPixels(to->tiles, pixels, to->w, to->h, to->fw, to->fh);
+		journalCompact(session->journal, pixels, to->w, to->h, to->fw, to->fh);
+	} else {
+		pixels = malloc(rect[2] * rect[3] * sizeof(*pixels));
+		tilesReadRect(to->tiles, to->w, to->h, to->fw, to->fh, rect, pixels);
+		journalRecord(session->journal, pixels, to->w, to->h, to->fw, to->fh, rect);
+	}
+	free(pixels);
 }
 
-static void setFgColor(struct rgba color)
+//
+// Record `snap` in the history file as the state at position `index`.
+// Returns where it was written, or -1.
+//
+static long snapshotSave(struct snapshot *snap, int index)
 {
-	session->fg = color;
-	paletteAddColor(0, 0, session->fg);
+	int32_t layers[snap->nlayers * 3 + 1];
+
+	for (int l = 0; l < snap->nlayers; l++) {
+		layers[l * 3]     = snap->layers[l].opacity;
+		layers[l * 3 + 1] = snap->layers[l].visible;
+		layers[l * 3 + 2] = snap->layers[l].blend;
+	}
+	return historyWrite(session->history, index, snap->tiles, snap->ntiles,
+	                    snap->fw, snap->fh, snap->w, snap->h, layers, snap->nlayers);
 }
 
-static void pickColor(int x, int y)
+//
+// Make `snap` the current state in the undo history, discarding the redo
+// branch.
+//
+static void spritePushSnapshot(struct sprite *s, struct snapshot snap)
 {
-	setFgColor(sample(x, y));
+	if (s->snapshot >= 0) // Record the committed edit
+		spriteJournal(s, &s->snapshots[s->snapshot], &snap);
+
+	if (s->snapshot < s->nsnapshots - 1) {
+		for (int i = s->snapshot + 1; i < s->nsnapshots; i++) {
+			if (s->snapshots[i].tiles)
+				tilesRelease(s->snapshots[i].tiles, s->snapshots[i].ntiles);
+			if (s->snapshots[i].spilled >= 0)
+				spillDrop(session->spill, s->snapshots[i].spilled);
+			free(s->snapshots[i].layers);
+		}
+		s->nsnapshots = s->snapshot + 1;
+	}
+	s->snapshots = realloc(s->snapshots, (s->nsnapshots + 1) * sizeof(*s->snapshots));
+	s->snapshots[s->nsnapshots] = snap;
+	s->nsnapshots++;
+	s->snapshot++;
+
+	if (session->history)
+		s->snapshots[s->snapshot].saved = snapshotSave(&s->snapshots[s->snapshot], s->snapshot);
+}
+
+//
+// Snapshot the sheet, with its layers stacked bottom layer first. Only the
+// tiles painted on since the last snapshot are interned again, the others
+// are shared with it.
+//
+static void spriteSnapshot(struct sprite *s)
+{
+	struct snapshot *curr = s->snapshot >= 0 ? &s->snapshots[s->snapshot] : NULL;
+	struct snapshot snap = (struct snapshot){
+		.layers  = spriteLayerProps(s),
+		.nlayers = s->nlayers,
+		.fw      = s->fw,
+		.fh      = s->fh,
+		.x       = 0,
+		.y       = 0,
+		.w       = s->fw * s->nframes,
+		.h       = s->fh * s->nlayers,
+		.spilled = -1,
+		.saved   = -1
+	};
+	int fw = s->fw, fh = s->fh;
+	bool incremental = curr && curr->w == snap.w && curr->h == snap.h && curr->fw == fw && curr->fh == fh;
+
+	snap.ntiles = s->nlayers * s->nframes * tilesPerFrame(fw, fh);
+	snap.tiles  = malloc(snap.ntiles * sizeof(*snap.tiles));
+
+	struct tile **t = snap.tiles;
+
+	for (int l = 0; l < s->nlayers; l++) {
+		for (int f = 0; f < s->nframes; f++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
+
+			// History tiles never straddle two page tiles, so they can be
+			// interned straight from the page.
+			for (int y = 0; y < fh; y += TILE_SIZE) {
+				for (int x = 0; x < fw; x += TILE_SIZE, t++) {
+					struct rect r = rect(f * fw + x, y, f * fw + x + TILE_SIZE, y + TILE_SIZE);
+					const struct rgba *px;
+
+					if (incremental && ((l != s->layer && !s->stale) || !rectIntersects(r, s->changed))) {
+						*t = curr->tiles[t - snap.tiles];
+						tileRetain(*t);
+					} else if (!page || !(px = pageAt(page, x, y))) {
+						*t = tileBlank();
+					} else {
+						*t = tileIntern(px, PAGE_TILE, min(TILE_SIZE, fw - x), min(TILE_SIZE, fh - y));
+					}
+				}
+			}
+		}
+	}
+	s->changed = NORECT;
+	s->stale   = false;
+
+	spritePushSnapshot(s, snap);
+}
+
+//
+// Snapshot a stroke that is still in progress, before an operation that
+// moves pixels around.
+//
+static void spriteCommit(struct sprite *s)
+{
+	if (!rectEmpty(s->changed))
+		spriteSnapshot(s);
+}
+
+//
+// Snapshot the result of a frame or layer operation, where frame `i` of
+// layer `j` is now what frame `frames[i]` of layer `layers[j]` of the
+// current snapshot was, or blank if either is -1. The tiles are taken from
+// the current snapshot, so no pixels are touched and the undo entry only
+// costs references.
+//
+static void spriteSnapshotFrom(struct sprite *s, const int *frames, int n, const int *layers, int nl)
+{
+	if (s->snapshot < 0)
+		return;
+
+	struct snapshot *curr = &s->snapshots[s->snapshot];
+	int per = tilesPerFrame(s->fw, s->fh),
+	    cn  = curr->w / s->fw,
+	    cl  = curr->h / s->fh;
+
+	if (curr->fw != s->fw || curr->fh != s->fh) {
+		spriteSnapshot(s);
+		return;
+	}
+
+	for (int i = 0; i < n; i++) {
+		if (frames[i] >= cn) { // History is behind, snapshot the pixels
+			spriteSnapshot(s);
+			return;
+		}
+	}
+	for (int j = 0; j < nl; j++) {
+		if (layers[j] >= cl) {
+			spriteSnapshot(s);
+			return;
+		}
+	}
+	struct snapshot snap = (struct snapshot){
+		.tiles   = malloc(nl * n * per * sizeof(struct tile *)),
+		.ntiles  = nl * n * per,
+		.layers  = spriteLayerProps(s),
+		.nlayers = s->nlayers,
+		.fw      = s->fw,
+		.fh      = s->fh,
+		.x       = 0,
+		.y       = 0,
+		.w       = s->fw * n,
+		.h       = s->fh * nl,
+		.spilled = -1,
+		.saved   = -1
+	};
+	for (int j = 0; j < nl; j++) {
+		for (int i = 0; i < n; i++) {
+			for (int k = 0; k < per; k++) {
+				struct tile *t;
+
+				if (frames[i] >= 0 && layers[j] >= 0) {
+					t = curr->tiles[(layers[j] * cn + frames[i]) * per + k];
+					tileRetain(t);
+				} else {
+					t = tileBlank();
+				}
+				snap.tiles[(j * n + i) * per + k] = t;
+			}
+		}
+	}
+	spritePushSnapshot(s, snap);
+}
+
+static void spriteFlash(struct sprite *s)
+{
+	// The window is cleared with this color on the next frame.
+	glClearColor(0.75, 0.0, 0.0, 1.0);
+}
+
+//
+// Resize the layer stack to `nl` layers, adding blank layers at the top or
+// removing layers from it.
+//
+static void spriteSetLayers(struct sprite *s, int nl)
+{
+	for (int l = nl; l < s->nlayers; l++) {
+		layerFree(s, &s->layers[l]);
+	}
+	s->layers = realloc(s->layers, nl * sizeof(*s->layers));
+
+	for (int l = s->nlayers; l < nl; l++) {
+		s->layers[l] = layerBlank(s);
+	}
+	s->nlayers = nl;
+	s->layer   = min(s->layer, nl - 1);
+}
+
+//
+// Page the tiles of `snap` back in from the history or spill file. Tiles
+// that are still held by other states are shared with them again.
+//
+static bool snapshotLoad(struct snapshot *snap)
+{
+	uint8_t *buf;
+	size_t n;
+
+	if (snap->tiles)
+		return true;
+
+	if (snap->saved >= 0)
+		return (snap->tiles = historyRead(session->history, snap->saved, snap->ntiles)) != NULL;
+
+	if ((buf = spillRead(session->spill, snap->spilled, &n)))
+		snap->tiles = tilesUnpack(buf, n, snap->ntiles);
+	free(buf);
+
+	return snap->tiles != NULL;
+}
+
+//
+// Page the tiles of `snap` out to the spill file, unless they're in the
+// history file already. Snapshots don't change, so they're only written
+// the first time.
+//
+static bool snapshotSpill(struct snapshot *snap)
+{
+	if (snap->saved < 0 && snap->spilled < 0) {
+		uint8_t *buf;
+		size_t n;
+
+		if (!session->spill && !(session->spill = spillOpen()))
+			return false;
+
+		buf = tilesPack(snap->tiles, snap->ntiles, &n);
+		snap->spilled = spillWrite(session->spill, buf, n);
+		free(buf);
+
+		if (snap->spilled < 0)
+			return false;
+	}
+	tilesRelease(snap->tiles, snap->ntiles);
+	snap->tiles = NULL;
+
+	return true;
+}
+
+static void spriteRestoreSnapshot(struct sprite *s, int snapshot)
+{
+	struct snapshot *snap = &s->snapshots[snapshot];
+
+	if (!snapshotLoad(snap)) {
+		debug("error: couldn't page in undo state %d", snapshot);
+		spriteFlash(s);
+		return;
+	}
+	int n   = snap->w / snap->fw,
+	    nl  = snap->h / snap->fh,
+	    per = tilesPerFrame(snap->fw, snap->fh);
+
+	if (n > SHEET_MAX / snap->fw || nl > SHEET_MAX / snap->fh) {
+		debug("error: undo state %d is larger than a sheet can be", snapshot);
+		spriteFlash(s);
+		return;
+	}
+	struct tile *blank = tileBlank();
+
+	spriteJournal(s, &s->snapshots[s->snapshot], snap);
+
+	s->snapshot = snapshot;
+
+	if (session->history)
+		historyCursor(session->history, snapshot);
+
+	// Layer settings aren't part of the history, unless layers were added
+	// or removed.
+	if (nl != s->nlayers) {
+		spriteSetLayers(s, nl);
+
+		for (int l = 0; l < nl; l++) {
+			s->layers[l].opacity = snap->layers[l].opacity;
+			s->layers[l].visible = snap->layers[l].visible;
+			s->layers[l].blend   = snap->layers[l].blend;
+		}
+	}
+	// The size is checked against the frames and layers of the snapshot,
+	// which were checked to fit above, so neither of these fails.
+	s->nframes = min(s->nframes, n);
+
+	if (snap->fw != s->fw || snap->fh != s->fh)
+		spriteResize(s, snap->fw, snap->fh);
+
+	// Snapshots are in frame order, so the frame table goes back to identity.
+	spriteReserve(s, n);
+
+	for (int i = 0; i < s->capacity; i++) {
+		s->frames[i] = i;
+	}
+	s->nframes = n;
+
+	spriteDropCache(s);
+
+	for (int f = n; f < s->capacity; f++) {
+		spriteClearSlot(s, f);
+	}
+	// Only the tiles that aren't blank are written, so pages stay as sparse
+	// as they were.
+	int cols = (s->fw + TILE_SIZE - 1) / TILE_SIZE;
+
+	for (int l = 0; l < nl; l++) {
+		struct layer *ly = &s->layers[l];
+
+		for (int f = 0; f < n; f++) {
+			pageFree(ly->pages[f]);
+			ly->pages[f] = NULL;
+
+			for (int i = 0; i < per; i++) {
+				struct tile *t = snap->tiles[(l * n + f) * per + i];
+				int x = i % cols * TILE_SIZE, y = i / cols * TILE_SIZE;
+
+				if (t != blank)
+					pageWrite(layerPage(s, ly, f), x, y, min(TILE_SIZE, s->fw - x), min(TILE_SIZE, s->fh - y),
+					          t->pixels, TILE_SIZE);
+			}
+		}
+	}
+	tileRelease(blank);
+
+	s->changed = NORECT;
+	spriteInvalidate(s);
+}
+
+static void spriteRedo(struct sprite *s)
+{
+	if (s->snapshot == s->nsnapshots - 1) { // Max redos reached
+		spriteFlash(s);
+		return;
+	}
+	spriteRestoreSnapshot(s, s->snapshot + 1);
+}
+
+static void spriteUndo(struct sprite *s)
+{
+	if (s->snapshot == 0) { // Max undos reached
+		spriteFlash(s);
+		return;
+	}
+	spriteRestoreSnapshot(s, s->snapshot - 1);
+}
+
+static void undo()
+{
+	spriteUndo(session->sprite);
+}
+
+static void redo()
+{
+	spriteRedo(session->sprite);
+}
+
+//
+// Grow the array of `size`-byte elements at `p` from `from` to `to`
+// elements, clearing the new ones.
+//
+static void *growSlots(void *p, size_t size, int from, int to)
+{
+	p = realloc(p, to * size);
+	memset((char *)p + from * size, 0, (to - from) * size);
+
+	return p;
+}
+
+//
+// Make room for at least `n` frames. Storage grows geometrically, so that
+// appending frames one at a time is amortized O(1). Nothing is allocated
+// for the pixels of the new slots until they are painted on: they are
+// blank, and added to the free end of the frame table.
+//
+static bool spriteReserve(struct sprite *s, int n)
+{
+	if (n <= s->capacity)
+		return true;
+
+	if (n > SHEET_MAX / s->fw)
+		return false;
+
+	int capacity = min(max(n, s->capacity * 2), SHEET_MAX / s->fw),
+	    per      = s->tcols * s->trows;
+
+	s->frames = realloc(s->frames, capacity * sizeof(*s->frames));
+
+	for (int i = s->capacity; i < capacity; i++) {
+		s->frames[i] = i;
+	}
+	for (int l = 0; l < s->nlayers; l++) {
+		s->layers[l].pages = growSlots(s->layers[l].pages, sizeof(struct page *), s->capacity, capacity);
+	}
+	s->below    = growSlots(s->below, sizeof(*s->below), s->capacity, capacity);
+	s->tiles    = growSlots(s->tiles, per * sizeof(*s->tiles), s->capacity, capacity);
+	if (s->cold)
+		s->cold = growSlots(s->cold, per, s->capacity, capacity);
+	s->capacity = capacity;
+
+	return true;
+}
+
+//
+// Change the size of the frames, dropping the pixels of all layers. The
+// frame table goes back to identity.
+//
+static bool spriteResize(struct sprite *s, int fw, int fh)
+{
+	if (fw * max(1, s->nframes) > SHEET_MAX || fh * s->nlayers > SHEET_MAX)
+		return false;
+
+	for (int i = 0; i < s->capacity; i++) {
+		spriteClearSlot(s, i);
+	}
+	free(s->tiles);
+	free(s->frames);
+
+	s->tiles    = NULL;
+	s->frames   = NULL;
+	s->capacity = 0;
+	s->fw       = fw;
+	s->fh       = fh;
+	s->tcols    = (fw + RENDER_TILE - 1) / RENDER_TILE;
+	s->trows    = (fh + RENDER_TILE - 1) / RENDER_TILE;
+
+	spriteReserve(s, max(1, s->nframes));
+	spriteInvalidate(s);
+
+	return true;
+}
+
+//
+// Rearrange the frames of a sprite, so that frame `i` becomes what frame
+// `order[i]` currently is, or a blank frame if it's -1. Frames are moved
+// by updating the frame table: pixels are only copied when a frame is used
+// twice, and a blank frame only clears its slot. The result is recorded as
+// an undo entry.
+//
+static bool spriteRearrange(struct sprite *s, const int *order, int n)
+{
+	if (!spriteReserve(s, n))
+		return false;
+
+	spriteCommit(s);
+
+	// Damage is kept in frame order, so it has to be flushed before frames
+	// move around.
+	spriteFlush(s);
+
+	int  *frames = malloc(s->capacity * sizeof(*frames)),
+	     *spare  = malloc(s->capacity * sizeof(*spare)),
+	     nspare  = 0;
+	bool *kept   = calloc(s->nframes + 1, sizeof(*kept));
+
+	// Frames that are used at all keep their slot the first time round.
+	for (int i = 0; i < n; i++) {
+		frames[i] = -1;
+
+		if (order[i] >= 0 && !kept[order[i]]) {
+			frames[i] = s->frames[order[i]];
+			kept[order[i]] = true;
+		}
+	}
+	for (int i = 0; i < s->capacity; i++) {
+		if (i >= s->nframes || !kept[i])
+			spare[nspare++] = s->frames[i];
+	}
+
+	// Copies and blank frames get a spare slot. Copies are composited again
+	// on the next flush, and blank frames have no textures at all.
+	int next = 0;
+
+	for (int i = 0; i < n; i++) {
+		if (frames[i] >= 0)
+			continue;
+
+		int dst = spare[next++];
+
+		if (order[i] >= 0) {
+			spriteCopySlot(s, s->frames[order[i]], dst);
+			s->damage = rectUnion(s->damage, rect(i * s->fw, 0, (i + 1) * s->fw, s->fh));
+		} else {
+			spriteClearSlot(s, dst);
+		}
+		frames[i] = dst;
+	}
+
+	// Frames that are gone don't need their pixels anymore.
+	for (int i = next; i < nspare; i++) {
+		spriteClearSlot(s, spare[i]);
+	}
+	memcpy(frames + n, spare + next, (nspare - next) * sizeof(*frames));
+	free(s->frames);
+	free(spare);
+	free(kept);
+
+	s->frames = frames;
+	s->nframes = n;
+
+	int *layers = frameOrder(s->nlayers);
+
+	spriteSnapshotFrom(s, order, n, layers, s->nlayers);
+	free(layers);
+
+	return true;
+}
+
+//
+// Rearrange the layers of a sprite, so that layer `i` becomes what layer
+// `order[i]` currently is, or a blank layer if it's -1. Layers that aren't
+// used anymore are freed. The result is recorded as an undo entry.
+//
+static void spriteRelayer(struct sprite *s, const int *order, int nl)
+{
+	struct layer *layers = malloc(nl * sizeof(*layers));
+	bool *kept = calloc(s->nlayers, sizeof(*kept));
+
+	spriteCommit(s);
+
+	for (int i = 0; i < nl; i++) {
+		if (order[i] >= 0) {
+			layers[i] = s->layers[order[i]];
+			kept[order[i]] = true;
+		} else {
+			layers[i] = layerBlank(s);
+		}
+	}
+	for (int i = 0; i < s->nlayers; i++) {
+		if (!kept[i])
+			layerFree(s, &s->layers[i]);
+	}
+	free(s->layers);
+	free(kept);
+
+	s->layers  = layers;
+	s->nlayers = nl;
+	s->layer   = max(0, min(s->layer, nl - 1));
+
+	spriteDropCache(s);
+	spriteInvalidate(s);
+
+	int *frames = frameOrder(s->nframes);
+
+	spriteSnapshotFrom(s, frames, s->nframes, order, nl);
+	free(frames);
+}
+
+//
+// Select the brush, painting with the blend mode in `arg`, eg. BLEND_ERASE
+// for an eraser.
+//
+static void brush(GLFWwindow *_w, const union arg *arg)
+{
+	session->tool.curr            = TOOL_BRUSH;
+	session->tool.u.brush.size    = +1;
+	session->tool.u.brush.prev.x  = -1;
+	session->tool.u.brush.prev.y  = -1;
+	session->tool.u.brush.curr.x  = -1;
+	session->tool.u.brush.curr.y  = -1;
+	session->tool.u.brush.drawing = false;
+	session->tool.u.brush.color   = TRANSPARENT;
+	session->tool.u.brush.blend   = arg ? arg->i : BLEND_NORMAL;
+}
+
+//
+// Create a sprite of `nlayers` layers of frames `fw * fh`. `pixels`, if
+// given, holds the layers stacked bottom layer first, and is `w` pixels
+// wide.
+//
+static struct sprite sprite(int fw, int fh, int nlayers, uint8_t *pixels, int w)
+{
+	struct sprite s = (struct sprite){
+		.tiles        = NULL,
+		.tcols        = (fw + RENDER_TILE - 1) / RENDER_TILE,
+		.trows        = (fh + RENDER_TILE - 1) / RENDER_TILE,
+		.dirty        = false,
+		.fw           = fw,
+		.fh           = fh,
+		.nframes      = 0,
+		.capacity     = 0,
+		.frames       = NULL,
+		.sweep        = 0,
+		.layers       = NULL,
+		.nlayers      = 0,
+		.layer        = 0,
+		.below        = NULL,
+		.damage       = NORECT,
+		.cold         = NULL,
+		.warm         = 0,
+		.changed      = NORECT,
+		.snapshot     = -1,
+		.snapshots    = NULL,
+		.nsnapshots   = 0
+	};
+	spriteSetLayers(&s, nlayers);
+
+	if (!pixels) {
+		spriteReserve(&s, 1);
+		return s;
+	}
+	spriteReserve(&s, max(1, w / fw));
+	s.nframes = w / fw;
+
+	for (int l = 0; l < nlayers; l++) {
+		for (int f = 0; f < s.nframes; f++) {
+			pageWrite(layerPage(&s, &s.layers[l], f), 0, 0, fw, fh,
+			          &((struct rgba *)pixels)[l * fh * w + f * fw], w);
+		}
+	}
+	// Squares are composited as they come into view, and in the
+	// background, rather than all before the first frame.
+	int per = s.tcols * s.trows;
+
+	s.cold = calloc(s.capacity, per);
+	memset(s.cold, 1, s.nframes * per);
+
+	return s;
+}
+
+//
+// Return the layers of the sheet stacked bottom layer first, in frame order.
+//
+static struct rgba *spriteReadPixels(struct sprite *s)
+{
+	int w = s->fw * s->nframes;
+	struct rgba *pixels = calloc(w * s->fh * s->nlayers, sizeof(*pixels));
+
+	for (int l = 0; l < s->nlayers; l++) {
+		for (int f = 0; f < s->nframes; f++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
+
+			if (page)
+				pageRead(page, 0, 0, s->fw, s->fh, &pixels[l * s->fh * w + f * s->fw], w);
+		}
+	}
+	return pixels;
+}
+
+static int *frameOrder(int n)
+{
+	int *order = malloc((n + 1) * sizeof(*order));
+
+	for (int i = 0; i < n; i++) {
+		order[i] = i;
+	}
+	return order;
+}
+
+//
+// Insert frame `src` of the current sprite at `pos`, or a blank frame if
+// `src` is -1.
+//
+static void spriteInsertFrame(struct sprite *s, int pos, int src)
+{
+	int *order = frameOrder(s->nframes);
+
+	memmove(order + pos + 1, order + pos, (s->nframes - pos) * sizeof(*order));
+	order[pos] = src;
+
+	if (!spriteRearrange(s, order, s->nframes + 1))
+		debug("error: sprite sheet can't hold more than %d frames", s->nframes);
+
+	free(order);
+}
+
+static void createFrame()
+{
+	struct sprite *s = session->sprite;
+
+	spriteInsertFrame(s, s->nframes, s->nframes - 1);
+}
+
+static int cursorFrame(GLFWwindow *win)
+{
+	struct sprite *s = session->sprite;
+	double x, y;
+
+	glfwGetCursorPos(win, &x, &y);
+
+	return max(0, min(s->nframes - 1, (int)floor((x - session->x) / (s->fw * session->zoom))));
+}
+
+static void insertFrame(GLFWwindow *win, const union arg *_)
+{
+	spriteInsertFrame(session->sprite, cursorFrame(win) + 1, -1);
+}
+
+static void duplicateFrame(GLFWwindow *win, const union arg *_)
+{
+	int f = cursorFrame(win);
+
+	spriteInsertFrame(session->sprite, f + 1, f);
+}
+
+static void deleteFrame(GLFWwindow *win, const union arg *_)
+{
+	struct sprite *s = session->sprite;
+	int f = cursorFrame(win);
+
+	if (s->nframes == 1) // Sprites always have at least one frame
+		return;
+
+	int *order = frameOrder(s->nframes);
+
+	memmove(order + f, order + f + 1, (s->nframes - f - 1) * sizeof(*order));
+	spriteRearrange(s, order, s->nframes - 1);
+
+	free(order);
+}
+
+static void moveFrame(GLFWwindow *win, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+	int f = cursorFrame(win), g = f + arg->i;
+
+	if (g < 0 || g >= s->nframes)
+		return;
+
+	int *order = frameOrder(s->nframes);
+
+	order[f] = g;
+	order[g] = f;
+	spriteRearrange(s, order, s->nframes);
+
+	free(order);
+}
+
+static void reverseFrames(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+	int *order = frameOrder(s->nframes);
+
+	for (int i = 0; i < s->nframes; i++) {
+		order[i] = s->nframes - 1 - i;
+	}
+	spriteRearrange(s, order, s->nframes);
+
+	free(order);
+}
+
+//
+// Apply `t` to every frame of every layer. Transforms that change the size
+// of the frames resize the sheet. Frames are transformed in parallel.
+//
+static void spriteTransform(struct sprite *s, enum transform t)
+{
+	int fw, fh, n = 0, nf = s->nframes;
+
+	transformSize(t, s->fw, s->fh, &fw, &fh);
+	spriteCommit(s);
+
+	const struct rgba **src = malloc(s->nlayers * nf * sizeof(*src));
+	struct rgba **dst = calloc(s->nlayers * nf, sizeof(*dst)),
+	            **out = malloc(s->nlayers * nf * sizeof(*out)),
+	            **in  = malloc(s->nlayers * nf * sizeof(*in));
+
+	// Blank pages stay blank. The others are transformed as whole frames, and
+	// split into tiles again.
+	for (int l = 0; l < s->nlayers; l++) {
+		for (int f = 0; f < nf; f++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
+
+			if (page && page->ntiles) {
+				src[n] = in[n] = malloc(s->fw * s->fh * sizeof(struct rgba));
+				out[n] = dst[l * nf + f] = malloc(fw * fh * sizeof(struct rgba));
+				pageRead(page, 0, 0, s->fw, s->fh, in[n], s->fw);
+				n++;
+			}
+		}
+	}
+	transformPages(t, src, out, n, s->fw, s->fh);
+
+	for (int i = 0; i < n; i++) {
+		free(in[i]);
+	}
+	if ((fw != s->fw || fh != s->fh) && !spriteResize(s, fw, fh)) {
+		debug("error: sprite sheet can't be %dx%d", fw * nf, fh);
+	} else {
+		for (int l = 0; l < s->nlayers; l++) {
+			for (int f = 0; f < nf; f++) {
+				struct page **page = &s->layers[l].pages[s->frames[f]];
+
+				pageFree(*page);
+				*page = NULL;
+
+				if (dst[l * nf + f])
+					pageWrite(layerPage(s, &s->layers[l], s->frames[f]), 0, 0, fw, fh, dst[l * nf + f], fw);
+			}
+		}
+		spriteDropCache(s);
+		spriteInvalidate(s);
+
+		s->changed = rect(0, 0, fw * nf, fh);
+		s->stale   = true;
+		spriteSnapshot(s);
+	}
+	for (int i = 0; i < n; i++) {
+		free(out[i]);
+	}
+	free(src);
+	free(dst);
+	free(out);
+	free(in);
+}
+
+//
+// Apply `t` to frame `f` of every layer. The result is centred on the
+// frame, and cropped to it.
+//
+static void spriteTransformFrame(struct sprite *s, int f, enum transform t)
+{
+	int ow, oh, slot = s->frames[f];
+
+	transformSize(t, s->fw, s->fh, &ow, &oh);
+	spriteCommit(s);
+
+	struct rgba *in  = malloc(s->fw * s->fh * sizeof(*in)),
+	            *out = malloc(ow * oh * sizeof(*out));
+	int ox = (ow - s->fw) / 2,
+	    oy = (oh - s->fh) / 2;
+
+	for (int l = 0; l < s->nlayers; l++) {
+		struct page **page = &s->layers[l].pages[slot];
+
+		if (!*page)
+			continue;
+
+		pageRead(*page, 0, 0, s->fw, s->fh, in, s->fw);
+		transformPixels(t, in, s->fw, s->fh, out);
+		memset(in, 0, s->fw * s->fh * sizeof(*in));
+
+		for (int y = max(0, -oy); y < min(s->fh, oh - oy); y++) {
+			int x0 = max(0, -ox), x1 = min(s->fw, ow - ox);
+
+			memcpy(&in[y * s->fw + x0], &out[(y + oy) * ow + x0 + ox], (x1 - x0) * sizeof(*in));
+		}
+		pageFree(*page);
+		*page = pageNew(s->fw, s->fh);
+		pageWrite(*page, 0, 0, s->fw, s->fh, in, s->fw);
+	}
+	free(in);
+	free(out);
+
+	struct rect r = rect(f * s->fw, 0, (f + 1) * s->fw, s->fh);
+
+	spriteDropCache(s);
+
+	s->damage  = rectUnion(s->damage, r);
+	s->changed = rectUnion(s->changed, r);
+	s->stale   = true;
+	spriteSnapshot(s);
+}
+
+//
+// Copy the rectangle `r` of layer `l` to `out`, going through the frame
+// table. `r` must be within the sheet.
+//
+static void spriteReadRect(struct sprite *s, int l, struct rect r, struct rgba *out)
+{
+	int w = r.x1 - r.x0;
+
+	for (int x = r.x0; x < r.x1;) {
+		int f = x / s->fw, end = min(r.x1, (f + 1) * s->fw);
+		struct page *page = s->layers[l].pages[s->frames[f]];
+
+		if (page) {
+			pageRead(page, x - f * s->fw, r.y0, end - x, r.y1 - r.y0, &out[x - r.x0], w);
+		} else {
+			for (int y = r.y0; y < r.y1; y++)
+				memset(&out[(y - r.y0) * w + x - r.x0], 0, (end - x) * sizeof(*out));
+		}
+		x = end;
+	}
+}
+
+//
+// Write the `w * h` pixels in `in` at `x, y` of the active layer, clipped to
+// the sheet.
+//
+static void spriteWriteRect(struct sprite *s, int x, int y, int w, int h, const struct rgba *in)
+{
+	struct rect r = rect(max(x, 0), max(y, 0), min(x + w, s->fw * s->nframes), min(y + h, s->fh));
+
+	if (rectEmpty(r))
+		return;
+
+	for (int px = r.x0; px < r.x1;) {
+		int f = px / s->fw, end = min(r.x1, (f + 1) * s->fw);
+
+		pageWrite(layerPage(s, &s->layers[s->layer], s->frames[f]), px - f * s->fw, r.y0, end - px, r.y1 - r.y0,
+		          &in[(r.y0 - y) * w + px - x], w);
+		px = end;
+	}
+	s->damage  = rectUnion(s->damage, r);
+	s->changed = rectUnion(s->changed, r);
+}
+
+//
+// Return the marquee selection in sheet pixels, clipped to the sheet.
+//
+static struct rect marqueeRect(struct sprite *s)
+{
+	struct marquee *m = &session->tool.u.marquee;
+	int z = session->zoom;
+
+	struct rect r = rect(
+		(min(m->min.x, m->max.x) - session->x) / z,
+		(min(m->min.y, m->max.y) - session->y) / z,
+		(max(m->min.x, m->max.x) - session->x) / z,
+		(max(m->min.y, m->max.y) - session->y) / z
+	);
+	return rect(max(r.x0, 0), max(r.y0, 0), min(r.x1, s->fw * s->nframes), min(r.y1, s->fh));
+}
+
+//
+// Return the selection, sized to the sheet, or NULL if nothing is selected.
+//
+static struct mask *spriteSelection(struct sprite *s)
+{
+	if (session->selection)
+		maskResize(session->selection, s->fw * s->nframes, s->fh);
+
+	return session->selection;
+}
+
+//
+// Find the next run of pixels of row `y`, from `*x` to `end`, that can be
+// painted: those in the selection, or all of them if there is none. The
+// selection must be sized to the sheet.
+//
+static inline int spriteSpan(int y, int *x, int end)
+{
+	if (session->selection)
+		return maskSpan(session->selection, y, x, end);
+
+	return max(end - *x, 0);
+}
+
+//
+// Combine `m`, a mask the size of the sheet, into the selection, and take
+// ownership of it. A selection left empty is dropped, so that the whole
+// sheet can be painted again.
+//
+static void spriteSelect(struct sprite *s, struct mask *m, enum maskop op)
+{
+	struct mask *sel = spriteSelection(s);
+
+	if (sel && op != MASK_REPLACE) {
+		maskCombine(sel, m, op);
+		maskFree(m);
+	} else {
+		// Subtracting from nothing, or intersecting with it, leaves nothing.
+		if (op == MASK_SUBTRACT || op == MASK_INTERSECT)
+			maskClear(m);
+
+		maskFree(sel);
+		session->selection = sel = m;
+	}
+	if (maskEmpty(sel)) {
+		maskFree(sel);
+		session->selection = NULL;
+	}
+}
+
+//
+// Shift adds to the selection, Alt subtracts from it, and both together
+// intersect with it.
+//
+static enum maskop selectOp(int mods)
+{
+	bool add = mods & GLFW_MOD_SHIFT, sub = mods & GLFW_MOD_ALT;
+
+	return add && sub ? MASK_INTERSECT : add ? MASK_UNION : sub ? MASK_SUBTRACT : MASK_REPLACE;
+}
+
+static void spriteSelectRect(struct sprite *s, struct rect r, enum maskop op)
+{
+	struct mask *m = maskNew(s->fw * s->nframes, s->fh);
+
+	maskRect(m, r.x0, r.y0, r.x1, r.y1);
+	spriteSelect(s, m, op);
+}
+
+//
+// Select the pixels of the active layer with the color found at window
+// position `x, y`: those connected to it, or every one if `global` is set.
+//
+static void spriteSelectColor(struct sprite *s, int x, int y, bool global, enum maskop op)
+{
+	int w = s->fw * s->nframes;
+
+	if (!spriteWithinBoundary(s, x, y))
+		return;
+
+	x = (x - session->x) / session->zoom;
+	y = (y - session->y) / session->zoom;
+
+	struct rgba *pixels = malloc(w * s->fh * sizeof(*pixels));
+	struct mask *m = maskNew(w, s->fh);
+
+	spriteReadRect(s, s->layer, rect(0, 0, w, s->fh), pixels);
+
+	if (global)
+		maskColor(m, pixels, pixels[y * w + x], WAND_TOLERANCE);
+	else
+		maskFlood(m, pixels, x, y, WAND_TOLERANCE);
+
+	free(pixels);
+	spriteSelect(s, m, op);
+}
+
+//
+// Split `r`, in sheet pixels, into the parts of the tiled frame it covers
+// once wrapped around the frame's edges, if tiling and `wrap` is set, or
+// else clip it to the sheet. The parts are stored in `out`, and their
+// number returned.
+//
+static int spriteWrap(struct sprite *s, struct rect r, bool wrap, struct rect out[4])
+{
+	if (!session->tiling || !wrap) {
+		out[0] = rect(max(r.x0, 0), max(r.y0, 0), min(r.x1, s->fw * s->nframes), min(r.y1, s->fh));
+		return !rectEmpty(out[0]);
+	}
+	int fx = min(session->tiled, s->nframes - 1) * s->fw,
+	    w  = min(r.x1 - r.x0, s->fw), // Anything wider covers the whole frame
+	    h  = min(r.y1 - r.y0, s->fh),
+	    x  = ((r.x0 - fx) % s->fw + s->fw) % s->fw,
+	    y  = (r.y0 % s->fh + s->fh) % s->fh,
+	    n  = 0;
+
+	// Each side is split in two where it crosses the edge of the frame.
+	int xs[2][2] = {{ x, min(x + w, s->fw) }, { 0, x + w - s->fw }},
+	    ys[2][2] = {{ y, min(y + h, s->fh) }, { 0, y + h - s->fh }};
+
+	for (int i = 0; i < 2; i++) {
+		for (int j = 0; j < 2; j++) {
+			struct rect p = rect(fx + xs[i][0], ys[j][0], fx + xs[i][1], ys[j][1]);
+
+			if (!rectEmpty(p))
+				out[n++] = p;
+		}
+	}
+	return n;
+}
+
+//
+// Set the pixels of `r` on the active layer to `c`, clipped to the sheet
+// and the selection.
+//
+static void spriteFillRect(struct sprite *s, struct rect r, struct rgba c)
+{
+	r = rect(max(r.x0, 0), max(r.y0, 0), min(r.x1, s->fw * s->nframes), min(r.y1, s->fh));
+
+	if (rectEmpty(r))
+		return;
+
+	spriteSelection(s);
+
+	for (int x0 = r.x0; x0 < r.x1;) {
+		int f = x0 / s->fw, end = min(r.x1, (f + 1) * s->fw);
+		struct page *page = layerPage(s, &s->layers[s->layer], s->frames[f]);
+
+		// Filling with transparent pixels doesn't allocate tiles.
+		for (int y = r.y0; y < r.y1; y++) {
+			for (int x = x0, n; (n = spriteSpan(y, &x, end)) > 0; x += n) {
+				for (int i = x, m; i < x + n; i += m) {
+					struct rgba *row = pageSpan(page, i - f * s->fw, y, &m, c.a > 0);
+
+					m = min(m, x + n - i);
+
+					for (int j = 0; row && j < m; j++)
+						row[j] = c;
+				}
+			}
+		}
+		x0 = end;
+	}
+	s->damage  = rectUnion(s->damage, r);
+	s->changed = rectUnion(s->changed, r);
+}
+
+//
+// Apply `t` to the selected pixels of the active layer. The result is
+// anchored at the top-left corner of the selection, and the selection takes
+// its new shape.
+//
+static void spriteTransformSelection(struct sprite *s, enum transform t)
+{
+	struct mask *sel = spriteSelection(s);
+	struct rect r;
+	int ow, oh;
+
+	if (!sel || !maskBounds(sel, &r.x0, &r.y0, &r.x1, &r.y1))
+		return;
+
+	int w = r.x1 - r.x0, h = r.y1 - r.y0;
+
+	transformSize(t, w, h, &ow, &oh);
+	spriteCommit(s);
+
+	struct rgba *in     = malloc(w * h * sizeof(*in)),
+	            *lifted = calloc(w * h, sizeof(*lifted)),
+	            *shape  = calloc(w * h, sizeof(*shape)),
+	            *out    = malloc(ow * oh * sizeof(*out)),
+	            *moved  = malloc(ow * oh * sizeof(*moved));
+
+	// Lift the selected pixels off the layer, along with the shape of the
+	// selection, which is transformed the same way.
+	spriteReadRect(s, s->layer, r, in);
+
+	for (int y = r.y0; y < r.y1; y++) {
+		for (int x = r.x0, n; (n = maskSpan(sel, y, &x, r.x1)) > 0; x += n) {
+			int i = (y - r.y0) * w + x - r.x0;
+
+			memcpy(&lifted[i], &in[i], n * sizeof(*in));
+			memset(&in[i], 0, n * sizeof(*in));
+
+			for (int j = i; j < i + n; j++)
+				shape[j] = WHITE;
+		}
+	}
+	spriteWriteRect(s, r.x0, r.y0, w, h, in);
+
+	transformPixels(t, lifted, w, h, out);
+	transformPixels(t, shape, w, h, moved);
+
+	// Put them back down where the shape lands on the sheet.
+	struct rect d = rect(r.x0, r.y0, min(r.x0 + ow, s->fw * s->nframes), min(r.y0 + oh, s->fh));
+	int dw = d.x1 - d.x0, dh = d.y1 - d.y0;
+	struct rgba *dst = realloc(in, dw * dh * sizeof(*dst));
+	struct mask *m = maskNew(s->fw * s->nframes, s->fh);
+
+	spriteReadRect(s, s->layer, d, dst);
+
+	for (int y = 0; y < dh; y++) {
+		for (int x = 0, start = -1; x <= dw; x++) {
+			bool hit = x < dw && moved[y * ow + x].a;
+
+			if (hit)
+				dst[y * dw + x] = out[y * ow + x];
+			if (hit && start < 0)
+				start = x;
+			if (!hit && start >= 0) {
+				maskRect(m, d.x0 + start, d.y0 + y, d.x0 + x, d.y0 + y + 1);
+				start = -1;
+			}
+		}
+	}
+	spriteWriteRect(s, d.x0, d.y0, dw, dh, dst);
+	spriteSelect(s, m, MASK_REPLACE);
+
+	free(dst);
+	free(lifted);
+	free(shape);
+	free(out);
+	free(moved);
+
+	spriteSnapshot(s);
+}
+
+//
+// Transform the selection if there is one, or else the frame under the
+// cursor.
+//
+static void frameTransform(GLFWwindow *win, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+
+	if (spriteSelection(s))
+		spriteTransformSelection(s, arg->i);
+	else
+		spriteTransformFrame(s, cursorFrame(win), arg->i);
+}
+
+static void sheetTransform(GLFWwindow *_, const union arg *arg)
+{
+	spriteTransform(session->sprite, arg->i);
+}
+
+//
+// Replace every color of the sprite with the nearest one in the palette,
+// dithered if `arg->i` is set.
+//
+static void remapColors(GLFWwindow *_, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+
+	spriteCommit(s);
+
+	for (int l = 0; l < s->nlayers; l++) {
+		for (int f = 0; f < s->nframes; f++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
+
+			// The dither pattern repeats within a tile, so tiles can be
+			// remapped on their own.
+			for (int i = 0; page && i < page->cols * page->rows; i++) {
+				if (page->tiles[i])
+					nearestRemap(palette->nearest, page->tiles[i], PAGE_TILE, PAGE_TILE, arg->i);
+			}
+		}
+	}
+	struct rect r = rect(0, 0, s->fw * s->nframes, s->fh);
+
+	spriteDropCache(s);
+
+	s->damage  = rectUnion(s->damage, r);
+	s->changed = rectUnion(s->changed, r);
+	s->stale   = true;
+	spriteSnapshot(s);
+}
+
+//
+// Toggle drawing the sheet through the color adjustments.
+//
+static void preview(GLFWwindow *_w, const union arg *_a)
+{
+	if (!adjust.program)
+		return;
+
+	adjust.on    = !adjust.on;
+	adjust.exact = true; // Warn again if it isn't
+}
+
+//
+// Move one of the color adjustments by `arg->p.y`, where `arg->p.x` is an
+// `enum adjustparam`, and preview the result.
+//
+static void adjustColors(GLFWwindow *_, const union arg *arg)
+{
+	if (!adjust.program)
+		return;
+
+	adjustStep(&adjust.params, arg->p.x, arg->p.y);
+	adjust.on = true;
+	adjustUpdate();
+}
+
+static void resetColors(GLFWwindow *_w, const union arg *_a)
+{
+	adjust.params = (struct adjustment){.high = 255};
+	adjustUpdate();
+}
+
+//
+// Apply the color adjustments being previewed to every layer, as a single
+// undo step. Pixels change exactly as they were previewed, unless layers
+// blend into colors of their own, which is warned about.
+//
+static void commitColors(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+
+	if (!adjust.on || adjustIdentity(&adjust.params))
+		return;
+
+	spriteCommit(s);
+	adjustCollect(s);
+
+	for (int l = 0; l < s->nlayers; l++) {
+		for (int f = 0; f < s->nframes; f++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
+
+			for (int i = 0; page && i < page->cols * page->rows; i++) {
+				if (page->tiles[i])
+					colormapApply(adjust.map, page->tiles[i], PAGE_TILE * PAGE_TILE);
+			}
+		}
+	}
+	struct rect r = rect(0, 0, s->fw * s->nframes, s->fh);
+
+	spriteDropCache(s);
+
+	s->damage  = rectUnion(s->damage, r);
+	s->changed = rectUnion(s->changed, r);
+	s->stale   = true;
+	spriteSnapshot(s);
+
+	adjust.on = false;
+	resetColors(NULL, NULL);
+}
+
+static void addLayer(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+	if (s->fh * (s->nlayers + 1) > SHEET_MAX) {
+		debug("error: sprite sheet can't hold more than %d layers", s->nlayers);
+		return;
+	}
+	int *order = frameOrder(s->nlayers);
+
+	// The new layer goes above the active one, and becomes active.
+	memmove(order + s->layer + 2, order + s->layer + 1, (s->nlayers - s->layer - 1) * sizeof(*order));
+	order[s->layer + 1] = -1;
+
+	spriteCommit(s);
+	s->layer++;
+	spriteRelayer(s, order, s->nlayers + 1);
+
+	free(order);
+}
+
+static void deleteLayer(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+
+	if (s->nlayers == 1) // Sprites always have at least one layer
+		return;
+
+	int *order = frameOrder(s->nlayers);
+
+	memmove(order + s->layer, order + s->layer + 1, (s->nlayers - s->layer - 1) * sizeof(*order));
+
+	spriteCommit(s);
+	s->layer = max(0, s->layer - 1);
+	spriteRelayer(s, order, s->nlayers - 1);
+
+	free(order);
+}
+
+static void selectLayer(GLFWwindow *_, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+	int l = s->layer + arg->i;
+
+	if (l < 0 || l >= s->nlayers)
+		return;
+
+	// Strokes are snapshotted for the layer they were painted on.
+	spriteCommit(s);
+	spriteDropCache(s);
+
+	s->layer = l;
+}
+
+//
+// Layer settings apply to the active layer. Since the cache only holds the
+// layers under it, changing them only takes recompositing.
+//
+static void toggleLayer(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+
+	s->layers[s->layer].visible = !s->layers[s->layer].visible;
+	spriteInvalidate(s);
+}
+
+static void layerOpacity(GLFWwindow *_, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+	struct layer *l = &s->layers[s->layer];
+
+	l->opacity = max(0, min(255, l->opacity + arg->i));
+	spriteInvalidate(s);
+}
+
+static void layerBlend(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+	struct layer *l = &s->layers[s->layer];
+
+	l->blend = (l->blend + 1) % BLEND_MODES;
+	spriteInvalidate(s);
+}
+
+static void addSprite(struct sprite s)
+{
+	session->sprites = realloc(session->sprites, (session->nsprites + 1) * sizeof(s));
+	session->sprites[session->nsprites] = s;
+	session->sprite = &session->sprites[session->nsprites];
+	session->nsprites++;
+}
+
+//
+// Return the path of the file with extension `ext` kept next to `path`.
+//
+static char *sidecarPath(const char *path, const char *ext)
+{
+	char *spath = malloc(strlen(path) + strlen(ext) + 1);
+
+	sprintf(spath, "%s%s", path, ext);
+
+	return spath;
+}
+
+//
+// Sheets with layers are saved as a single image, with the layers stacked
+// bottom layer first. The image ID records the frame width, the layer count,
+// and the opacity, visibility and blend mode of each layer, eg.
+// "px 16 2 255,1,0 128,1,2".
+//
+static void spriteDescribe(struct sprite *s, char *id, size_t size)
+{
+	int n = snprintf(id, size, "px %d %d", s->fw, s->nlayers);
+
+	for (int l = 0; l < s->nlayers && n < size; l++) {
+		struct layer *ly = &s->layers[l];
+
+		n += snprintf(id + n, size - n, " %d,%d,%d", ly->opacity, ly->visible, ly->blend);
+	}
+	if (n >= size) // Too many layers to describe, the rest keep the defaults
+		*strrchr(id, ' ') = '\0';
+}
+
+static bool sheetParse(const char *id, int *fw, int *nlayers)
+{
+	return sscanf(id, "px %d %d", fw, nlayers) == 2 && *fw > 0 && *nlayers > 0;
+}
+
+static void spriteParseLayers(struct sprite *s, const char *id)
+{
+	int fw, nlayers, n;
+
+	if (sscanf(id, "px %d %d%n", &fw, &nlayers, &n) != 2)
+		return;
+
+	for (int l = 0, op, vis, blend, m; l < s->nlayers; l++, n += m) {
+		if (sscanf(id + n, " %d,%d,%d%n", &op, &vis, &blend, &m) != 3)
+			break;
+
+		s->layers[l].opacity = max(0, min(255, op));
+		s->layers[l].visible = vis;
+		s->layers[l].blend   = blend >= 0 && blend < BLEND_MODES ? blend : BLEND_NORMAL;
+	}
+}
+
+//
+// Return whether `path` names a PNG, going by its extension. Anything else
+// is a TGA.
+//
+static bool pathIsPNG(const char *path)
+{
+	const char *ext = strrchr(path, '.');
+
+	return ext && (!strcmp(ext, ".png") || !strcmp(ext, ".PNG"));
+}
+
+static struct tga *imageDecode(const char *path)
+{
+	if (!pathIsPNG(path))
+		return tgaDecode(path);
+
+	struct png *p = pngDecode(path);
+	struct tga *t;
+
+	if (!p)
+		return NULL;
+
+	if (p->width > SHRT_MAX || p->height > SHRT_MAX) {
+		free(p->data);
+		free(p);
+		errno = EFBIG;
+		return NULL;
+	}
+	t = calloc(1, sizeof(*t));
+	t->width  = p->width;
+	t->height = p->height;
+	t->depth  = p->depth;
+	t->data   = p->data;
+	memcpy(t->id, p->id, sizeof(t->id));
+
+	free(p);
+
+	return t;
+}
+
+//
+// Decode the image of `l` and replay its journal. This runs on a thread of
+// its own at startup, while the window comes up, so it doesn't touch the
+// session or GL.
+//
+static void *loadDecode(void *arg)
+{
+	struct load *l = arg;
+	struct tga *t;
+
+	l->started = glfwGetTime();
+
+	if ((t = imageDecode(l->path)) == NULL) {
+		if (errno != ENOENT) {
+			l->error = errno;
+			goto done;
+		}
+		// The image may never have been saved, but still have a journal.
+		t = calloc(1, sizeof(*t));
+		t->depth = 32;
+	}
+	l->decoded = glfwGetTime();
+	l->image   = t;
+	l->pixels  = (struct rgba *)t->data;
+	l->w       = t->width;
+	l->h       = t->height;
+	l->fw      = t->height;
+
+	int nlayers = 1;
+
+	if (!sheetParse(t->id, &l->fw, &nlayers) || l->h % nlayers)
+		nlayers = 1;
+
+	l->fh = l->h / nlayers;
+
+	// Replay any edits that didn't make it to disk before the last exit.
+	char *jpath = sidecarPath(l->path, ".journal");
+
+	l->replayed = journalReplay(jpath, &l->pixels, &l->w, &l->h, &l->fw, &l->fh);
+	free(jpath);
+done:
+	pthread_mutex_lock(&l->lock);
+	l->finished = glfwGetTime();
+	l->done = true;
+	pthread_mutex_unlock(&l->lock);
+
+	return NULL;
+}
+
+static void loadStart(struct load *l, char *path)
+{
+	*l = (struct load){ .path = path };
+
+	pthread_mutex_init(&l->lock, NULL);
+
+	// Without a thread, the image is decoded right away.
+	if (pthread_create(&l->thread, NULL, loadDecode, l)) {
+		loadDecode(l);
+		l->sync = true;
+	}
+}
+
+static bool loadDone(struct load *l)
+{
+	pthread_mutex_lock(&l->lock);
+	bool done = l->done;
+	pthread_mutex_unlock(&l->lock);
+
+	return done;
+}
+
+//
+// Wait for the thread decoding `l` to finish. Its fields may only be read
+// from then on.
+//
+static void loadWait(struct load *l)
+{
+	if (!l->sync)
+		pthread_join(l->thread, NULL);
+	pthread_mutex_destroy(&l->lock);
+}
+
+//
+// Add the sheet of `l`, once it is waited for. Returns false if there's
+// nothing to load.
+//
+static bool loadSprites(struct load *l)
+{
+	struct tga *t = l->image;
+	struct sprite s;
+
+	session->filepath = l->path;
+
+	if (l->error) {
+		errno = l->error;
+		fatal(" couldn't load image '%s'", l->path);
+	}
+	if (l->replayed > 0)
+		debug("recovered %d edit(s) from '%s.journal'", l->replayed, l->path);
+
+	if (!l->pixels) {
+		free(t);
+		return false;
+	}
+	s = sprite(l->fw, l->fh, l->h / l->fh, (uint8_t *)l->pixels, l->w);
+	s.image = t;
+
+	spriteParseLayers(&s, t->id);
+
+	debug("loading image '%s' (%dx%dx%d, %d layer(s))\n", l->path, l->w, l->fh, t->depth, s.nlayers);
+
+	// The layers hold the pixels from now on.
+	free(l->pixels);
+	t->data = NULL;
+
+	addSprite(s);
+
+	return true;
+}
+
+static bool spriteWithinBoundary(struct sprite *s, int x, int y)
+{
+	return session->x <= x && x < (session->x + s->fw * s->nframes * session->zoom) &&
+		session->y <= y && y < (session->y + s->fh * session->zoom);
+}
+
+//
+// Pick up the undo history left by earlier sessions, if it ends with the
+// sheet as it was loaded. Otherwise the sheet was changed elsewhere, and
+// the file starts over with a new timeline. Only the current state is read: the
+// others stay on disk until they're undone to.
+//
+static void spriteResume(struct sprite *s)
+{
+	char *hpath = sidecarPath(session->filepath, ".history");
+	struct snapshot *snap = &s->snapshots[s->snapshot];
+	struct history *h;
+
+	if (!(h = session->history = historyOpen(hpath))) {
+		debug("error: couldn't open '%s': %s", hpath, strerror(errno));
+		free(hpath);
+		return;
+	}
+	struct historystate *c = h->current >= 0 ? &h->states[h->current] : NULL;
+	struct tile **tiles = NULL;
+	bool same = false;
+	int rect[4];
+
+	if (c && c->fw == snap->fw && c->fh == snap->fh && c->w == snap->w && c->h == snap->h && c->ntiles == snap->ntiles)
+		tiles = historyRead(h, c->offset, c->ntiles);
+
+	if (tiles) {
+		same = !tilesDiff(tiles, c->ntiles, snap->tiles, snap->ntiles, snap->w, snap->h, snap->fw, snap->fh, rect);
+		tilesRelease(tiles, c->ntiles);
+	}
+	if (!same) {
+		historyReset(h);
+		snap->saved = snapshotSave(snap, 0);
+		free(hpath);
+		return;
+	}
+	struct snapshot *snaps = malloc(h->nstates * sizeof(*snaps));
+
+	for (int i = 0; i < h->nstates; i++) {
+		struct historystate *st = &h->states[i];
+
+		if (i == h->current) {
+			snaps[i] = *snap;
+			snaps[i].saved = st->offset;
+			continue;
+		}
+		snaps[i] = (struct snapshot){
+			.tiles   = NULL,
+			.ntiles  = st->ntiles,
+			.layers  = calloc(st->nlayers, sizeof(struct layer)),
+			.nlayers = st->nlayers,
+			.fw      = st->fw,
+			.fh      = st->fh,
+			.x       = 0,
+			.y       = 0,
+			.w       = st->w,
+			.h       = st->h,
+			.spilled = -1,
+			.saved   = st->offset
+		};
+		for (int l = 0; l < st->nlayers; l++) {
+			snaps[i].layers[l].opacity = st->layers[l * 3];
+			snaps[i].layers[l].visible = st->layers[l * 3 + 1];
+			snaps[i].layers[l].blend   = st->layers[l * 3 + 2] >= 0 && st->layers[l * 3 + 2] < BLEND_MODES ?
+			                             st->layers[l * 3 + 2] : BLEND_NORMAL;
+		}
+	}
+	free(s->snapshots);
+
+	s->snapshots  = snaps;
+	s->nsnapshots = h->nstates;
+	s->snapshot   = h->current;
+
+	debug("resuming %d undo state(s) from '%s'", s->nsnapshots, hpath);
+	free(hpath);
+}
+
+static struct point snap(struct point p)
+{
+	return (struct point){
+		.x = p.x - (p.x % session->zoom),
+		.y = p.y - (p.y % session->zoom)
+	};
+}
+
+//
+// Convert window position `x, y` to sheet pixels. Strokes and shapes can
+// start left of or above the sheet when tiling.
+//
+static struct point sheetPoint(int x, int y)
+{
+	return point((int)floor((double)(x - session->x) / session->zoom),
+	             (int)floor((double)(y - session->y) / session->zoom));
+}
+
+static void drawCursor(GLFWwindow *win, int x, int y, enum tool t)
+{
+	int s = session->tool.u.brush.size * session->zoom;
+
+	struct point n = snap(point(x, y));
+	struct sprite *sp = session->sprite;
+
+	switch (t) {
+	case TOOL_BRUSH:
+	case TOOL_MULTI: {
+			struct point p = sheetPoint(x, y), copies[SYMMETRY_MAX_FOLDS];
+			int ncopies = symmetryCopies(sp, p.x, p.y, session->tool.u.brush.size, copies),
+			    frames  = t == TOOL_MULTI ? sp->nframes : 1;
+
+			// The stamp and every copy of it that painting would make.
+			for (int i = 0; i < ncopies; i++) {
+				for (int f = 0; f < frames && copies[i].x + f * sp->fw < sp->fw * sp->nframes; f++) {
+					int cx = session->x + (copies[i].x + f * sp->fw) * session->zoom,
+					    cy = session->y + copies[i].y * session->zoom;
+
+					if (session->tool.u.brush.blend == BLEND_ERASE) {
+						boundaryDraw(WHITE, cx, cy, cx + s, cy + s);
+					} else if (spriteWithinBoundary(sp, x, y)) {
+						fillRect(cx, cy, cx + s, cy + s, session->fg);
+					} else {
+						boundaryDraw(GREY, cx, cy, cx + s, cy + s);
+					}
+				}
+			}
+		}
+		break;
+	case TOOL_SAMPLER:
+	case TOOL_WAND:
+		boundaryDraw(WHITE, n.x, n.y, n.x + s, n.y + s);
+		break;
+	case TOOL_SHAPE:
+		boundaryDraw(WHITE, n.x, n.y, n.x + session->zoom, n.y + session->zoom);
+		break;
+	case TOOL_MARQUEE: {
+			struct marquee *m = &session->tool.u.marquee;
+			if (m->state == MARQUEE_STARTED) { // Draw marquee
+				fillRect(m->min.x, m->min.y, m->max.x, m->max.y, LIGHT);
+				glEnable(GL_COLOR_LOGIC_OP);
+				glLogicOp(GL_INVERT);
+				boundaryDraw(GREY, m->min.x, m->min.y, m->max.x, m->max.y);
+				glDisable(GL_COLOR_LOGIC_OP);
+			}
+			if (m->state == MARQUEE_ENDED) {
+				boundaryDraw(WHITE, n.x, n.y, n.x + 1, n.y + 1);
+			} else if (m->state == MARQUEE_CUT) {
+				struct rect r = marqueeRect(sp);
+
+				glPushMatrix();
+				glTranslatef(n.x, n.y, 0);
+				glScalef(session->zoom, session->zoom, 1.0f);
+				spriteDrawRect(sp, r, 0, 0);
+				glPopMatrix();
+			}
+			break;
+		}
+	}
+}
+
+static void spriteDraw(struct sprite *s, int x, int y)
+{
+	// TODO(cloudhead): put this in a function
+	session->tool.u.brush.prev = session->tool.u.brush.curr;
+	session->tool.u.brush.curr = sheetPoint(x, y);
+
+	s->dirty = true;
+}
+
+//
+// Blend `c` onto pixels `x0` to `x1` of row `y` of the active layer with
+// `mode`, going through the frame table, and clipped to the selection. The
+// span must be within the sheet, and is split where it straddles two
+// frames, since those needn't be next to each other in memory.
+//
+static void spriteBlendSpan(struct sprite *s, int y, int x0, int x1, struct rgba c, enum blend mode)
+{
+	struct layer *l = &s->layers[s->layer];
+
+	// The eraser doesn't allocate tiles where there is nothing to erase.
+	bool alloc = mode != BLEND_ERASE;
+
+	while (x0 < x1) {
+		int f   = x0 / s->fw,
+		    end = min(x1, (f + 1) * s->fw);
+		struct page *page = layerPage(s, l, s->frames[f]);
+
+		for (int x = x0, n; (n = spriteSpan(y, &x, end)) > 0; x += n) {
+			for (int i = x, m; i < x + n; i += m) {
+				struct rgba *row = pageSpan(page, i - f * s->fw, y, &m, alloc);
+
+				if (row)
+					blendFill(row, c, min(m, x + n - i), mode);
+			}
+		}
+		x0 = end;
+	}
+}
+
+//
+// Blend `c` onto the part `r` of the active layer, which must be within the
+// sheet, with `mode`.
+//
+static void spriteBlendRect(struct sprite *s, struct rect r, struct rgba c, enum blend mode)
+{
+	s->damage  = rectUnion(s->damage, r);
+	s->changed = rectUnion(s->changed, r);
+
+	for (int y = r.y0; y < r.y1; y++) {
+		spriteBlendSpan(s, y, r.x0, r.x1, c, mode);
+	}
+}
+
+//
+// Store in `out` the position of a `size * size` stamp at `x, y` and of its
+// copies by the symmetry mode, mirrored or rotated around the center of the
+// frame it is in. Returns the number of stamps.
+//
+static int symmetryCopies(struct sprite *s, int x, int y, int size, struct point out[SYMMETRY_MAX_FOLDS])
+{
+	int fx = (int)floor((double)x / s->fw) * s->fw, // Frame the stamp is in
+	    mx = fx + s->fw - (x - fx) - size,          // Mirrored across the frame's middle
+	    my = s->fh - y - size,
+	    n  = 0;
+
+	out[n++] = point(x, y);
+
+	switch (session->symmetry) {
+	case SYMMETRY_NONE:
+		break;
+	case SYMMETRY_HORIZONTAL:
+		out[n++] = point(mx, y);
+		break;
+	case SYMMETRY_VERTICAL:
+		out[n++] = point(x, my);
+		break;
+	case SYMMETRY_FOUR:
+		out[n++] = point(mx, y);
+		out[n++] = point(x, my);
+		out[n++] = point(mx, my);
+		break;
+	case SYMMETRY_RADIAL: {
+			double cx = x - fx + size / 2.0 - s->fw / 2.0, // Stamp center, from the frame center
+			       cy = y + size / 2.0 - s->fh / 2.0;
+
+			for (int k = 1; k < session->folds; k++) {
+				double a = TAU * k / session->folds,
+				       rx = cx * cos(a) - cy * sin(a),
+				       ry = cx * sin(a) + cy * cos(a);
+
+				out[n++] = point(fx + (int)floor(rx + (s->fw - size) / 2.0 + 0.5),
+				                 (int)floor(ry + (s->fh - size) / 2.0 + 0.5));
+			}
+		}
+		break;
+	}
+	return n;
+}
+
+//
+// Grow the batch buffer `*buf` of `size`-byte items to hold `n` of them.
+//
+static void *stampReserve(void *buf, int *cap, int n, size_t size)
+{
+	if (n <= *cap)
+		return buf;
+
+	*cap = max(*cap * 2, n);
+
+	return realloc(buf, *cap * size);
+}
+
+//
+// Add a stamp at each point of the path to the batch, along with its copies
+// by the symmetry mode and, with the multi-frame brush, in every frame from
+// there on. The stamps of each copy are added one after the other, so that
+// stamps next to each other in the batch mostly overlap. Stamps are clipped
+// to the sheet, or wrapped around the tiled frame when tiling.
+//
+static void stampReplicate(struct sprite *s, int size)
+{
+	bool multi   = session->tool.curr == TOOL_MULTI;
+	int  frames  = multi ? s->nframes : 1,
+	     ncopies = 0;
+
+	stamps.copies = stampReserve(stamps.copies, &stamps.ccap,
+	                             stamps.npath * SYMMETRY_MAX_FOLDS, sizeof(*stamps.copies));
+
+	for (int p = 0; p < stamps.npath; p++) {
+		ncopies = symmetryCopies(s, stamps.path[p].x, stamps.path[p].y, size,
+		                         &stamps.copies[p * SYMMETRY_MAX_FOLDS]);
+	}
+	for (int i = 0; i < ncopies; i++) {
+		for (int f = 0; f < frames; f++) {
+			for (int p = 0; p < stamps.npath; p++) {
+				struct point c = stamps.copies[p * SYMMETRY_MAX_FOLDS + i];
+				struct rect parts[4];
+				int nparts = spriteWrap(s, rect(c.x + f * s->fw, c.y, c.x + f * s->fw + size, c.y + size), !multi, parts);
+
+				stamps.rects = stampReserve(stamps.rects, &stamps.cap, stamps.n + nparts, sizeof(*stamps.rects));
+
+				for (int j = 0; j < nparts; j++) {
+					stamps.rects[stamps.n++] = parts[j];
+				}
+			}
+		}
+	}
+}
+
+//
+// Blend the batch of stamps onto the active layer in one pass, so that each
+// pixel is blended once however many stamps cover it. The stamps are cut
+// into spans, bucketed by row. A span that overlaps the last one of its row
+// is merged into it as it is added, which covers most of them, since
+// stamps that follow each other along a stroke overlap. What is left of
+// each row is sorted, merged and blended.
+//
+static void spriteBlendStamps(struct sprite *s, struct rgba c, enum blend mode)
+{
+	struct rect bounds = NORECT;
+
+	if (stamps.n == 0)
+		return;
+
+	for (int i = 0; i < stamps.n; i++) {
+		bounds = rectUnion(bounds, stamps.rects[i]);
+	}
+	int rows = bounds.y1 - bounds.y0, total = 0;
+
+	stamps.rows = stampReserve(stamps.rows, &stamps.rcap, 2 * rows + 1, sizeof(*stamps.rows));
+
+	// Count the spans of each row, at most, to lay out the buckets. `start`
+	// holds where the bucket of each row starts, and `end` where it ends.
+	int *start = stamps.rows, *end = stamps.rows + rows + 1;
+
+	memset(start, 0, (rows + 1) * sizeof(*start));
+
+	for (int i = 0; i < stamps.n; i++) {
+		start[stamps.rects[i].y0 - bounds.y0]++;
+		start[stamps.rects[i].y1 - bounds.y0]--;
+	}
+	for (int y = 0, n = 0; y < rows; y++) {
+		n       += start[y];
+		start[y] = total;
+		end[y]   = total;
+		total   += n;
+	}
+	stamps.spans = stampReserve(stamps.spans, &stamps.scap, total, sizeof(*stamps.spans));
+
+	for (int i = 0; i < stamps.n; i++) {
+		struct rect r = stamps.rects[i];
+
+		for (int y = r.y0 - bounds.y0; y < r.y1 - bounds.y0; y++) {
+			struct span *last = &stamps.spans[end[y] - 1];
+
+			if (end[y] > start[y] && r.x0 <= last->x1 && r.x1 >= last->x0) {
+				last->x0 = min(last->x0, r.x0);
+				last->x1 = max(last->x1, r.x1);
+			} else {
+				stamps.spans[end[y]++] = (struct span){ r.x0, r.x1 };
+			}
+		}
+	}
+	spriteSelection(s);
+
+	for (int y = 0; y < rows; y++) {
+		struct span *row = &stamps.spans[start[y]];
+		int n = end[y] - start[y];
+
+		// Rows only hold a few spans by now, one per copy of the stamp.
+		for (int i = 1; i < n; i++) {
+			struct span t = row[i];
+			int j = i;
+
+			for (; j > 0 && row[j - 1].x0 > t.x0; j--) {
+				row[j] = row[j - 1];
+			}
+			row[j] = t;
+		}
+		for (int i = 0; i < n;) {
+			struct span sp = row[i];
+
+			for (i++; i < n && row[i].x0 <= sp.x1; i++) {
+				sp.x1 = max(sp.x1, row[i].x1);
+			}
+			spriteBlendSpan(s, bounds.y0 + y, sp.x0, sp.x1, c, mode);
+		}
+	}
+	s->damage  = rectUnion(s->damage, bounds);
+	s->changed = rectUnion(s->changed, bounds);
+	stamps.n   = 0;
+}
+
+//
+// Stamp the brush along the line from `x, y` to `x1, y1`, or just at `x, y`
+// when the stroke starts.
+//
+static void spritePaint(struct sprite *s, int x, int y, int x1, int y1)
+{
+	stamps.npath = 0;
+	stamps.path  = stampReserve(stamps.path, &stamps.pcap, abs(x1 - x) + abs(y1 - y) + 2, sizeof(*stamps.path));
+
+	if (session->tool.u.brush.drawing > DRAW_STARTED) {
+		int dx = abs(x1 - x);
+		int dy = abs(y1 - y);
+		int sx = x < x1 ? 1 : -1;
+		int sy = y < y1 ? 1 : -1;
+		int err = dx - dy;
+
+		for (;;) {
+			stamps.path[stamps.npath++] = point(x, y);
+
+			if (x == x1 && y == y1)
+				break;
+
+			int err2 = err * 2;
+
+			if (err2 > -dy) {
+				err -= dy;
+				x += sx;
+			}
+			if (x == x1 && y == y1) {
+				stamps.path[stamps.npath++] = point(x, y);
+				break;
+			}
+			if (err2 < dx) {
+				err += dx;
+				y += sy;
+			}
+		}
+	} else {
+		stamps.path[stamps.npath++] = point(x, y);
+	}
+	stampReplicate(s, session->tool.u.brush.size);
+	spriteBlendStamps(s, session->fg, session->tool.u.brush.blend);
+}
+
+//
+// Paint the brush strokes since the last frame into the active layer, and
+// bring the composite up to date.
+//
+static void spriteRender(struct sprite *s)
+{
+	if (s->dirty) {
+		int x  = session->tool.u.brush.curr.x;
+		int y  = session->tool.u.brush.curr.y;
+		int x1 = session->tool.u.brush.prev.x;
+		int y1 = session->tool.u.brush.prev.y;
+
+		switch (session->tool.curr) {
+		case TOOL_BRUSH:
+		case TOOL_MULTI:
+			spritePaint(s, x, y, x1, y1);
+			break;
+		default:
+			break;
+		}
+		s->dirty = false;
+	}
+	spriteFlush(s);
+}
+
+static void spriteRenderFrame(struct sprite *s, int frame)
+{
+	if (frame < 0 || frame >= s->nframes)
+		return;
+
+	spriteDrawSlot(s, s->frames[frame], rect(0, 0, s->fw, s->fh), 0, 0);
+}
+
+static void spriteRenderCurrentFrame(struct sprite *s)
+{
+	double elapsed = glfwGetTime() - session->started;
+	double frac = session->fps * elapsed;
+	int frame = (int)floor(frac) % s->nframes;
+
+	spriteRenderFrame(s, frame);
+}
+
+//
+// Release the pixel tiles of `COMPACT_SLOTS` slots that were painted on and
+// are transparent again, along with the pages and composite textures left
+// with nothing to hold. Slots are visited in turn, a few per frame, so that
+// memory follows the painted area without a pause.
+//
+static void spriteCompact(struct sprite *s)
+{
+	for (int i = 0; i < min(COMPACT_SLOTS, s->capacity); i++) {
+		int slot = s->sweep % s->capacity, released = 0;
+
+		s->sweep = (slot + 1) % s->capacity;
+
+		for (int l = 0; l < s->nlayers; l++) {
+			struct page **page = &s->layers[l].pages[slot];
+
+			if (!*page || !pageCompact(*page))
+				continue;
+
+			if (l < s->layer) { // The cache has the old tiles
+				pageFree(s->below[slot]);
+				s->below[slot] = NULL;
+			}
+			if (!(*page)->ntiles) {
+				pageFree(*page);
+				*page = NULL;
+			}
+			released++;
+		}
+		for (int y = 0; released && y < s->fh; y += RENDER_TILE) {
+			for (int x = 0; x < s->fw; x += RENDER_TILE) {
+				struct texture **t = spriteTile(s, slot, x, y);
+
+				if (*t && !spriteTileNeeded(s, slot, x, y, min(RENDER_TILE, s->fw - x), min(RENDER_TILE, s->fh - y))) {
+					textureDelete(*t);
+					*t = NULL;
+				}
+			}
+		}
+	}
+}
+
+static size_t textureBytes(const struct texture *t)
+{
+	return t ? (size_t)t->w * t->h * sizeof(struct rgba) : 0;
+}
+
+static struct memstats memoryStats(void)
+{
+	struct memstats m = {
+		.history = tileStats().bytes,
+		.spilled = session->spill ? session->spill->bytes : 0
+	};
+	for (int k = 0; k < session->nsprites; k++) {
+		struct sprite *s = &session->sprites[k];
+
+		for (int i = 0; i < s->capacity; i++) {
+			for (int l = 0; l < s->nlayers; l++) {
+				m.canvas += pageBytes(s->layers[l].pages[i]);
+			}
+			m.canvas += pageBytes(s->below[i]);
+		}
+		for (int i = 0; i < s->capacity * s->tcols * s->trows; i++) {
+			m.textures += textureBytes(s->tiles[i]);
+		}
+		for (int i = 0; i < s->nsnapshots; i++) {
+			struct snapshot *snap = &s->snapshots[i];
+
+			m.history += sizeof(*snap) + snap->nlayers * sizeof(*snap->layers) +
+			             (snap->tiles ? snap->ntiles * sizeof(*snap->tiles) : 0);
+		}
+	}
+	m.textures += textureBytes(session->tile) + textureBytes(glyphs) + textureBytes(palette->texture);
+	// The palette keeps the pixels of its texture around.
+	m.palette   = textureBytes(palette->texture) + palette->ncolors * sizeof(*palette->colors);
+
+	return m;
+}
+
+//
+// While memory is over budget, page out one undo state per frame, the one
+// furthest from the current state of its sprite, so that undoing a few
+// steps doesn't wait on the disk. Paging out only frees the tiles no other
+// state holds, which is why it goes on until memory is back under budget.
+//
+static void historyTrim(void)
+{
+	struct snapshot *victim = NULL;
+	int furthest = 0;
+
+	if (!session->budget)
+		return;
+
+	struct memstats m = memoryStats();
+
+	if (m.canvas + m.textures + m.history + m.palette <= session->budget)
+		return;
+
+	for (int k = 0; k < session->nsprites; k++) {
+		struct sprite *s = &session->sprites[k];
+
+		for (int i = 0; i < s->nsnapshots; i++) {
+			if (s->snapshots[i].tiles && abs(i - s->snapshot) > furthest) {
+				victim   = &s->snapshots[i];
+				furthest = abs(i - s->snapshot);
+			}
+		}
+	}
+	if (victim && !snapshotSpill(victim)) {
+		debug("error: couldn't page out undo history: %s, ignoring the memory budget", strerror(errno));
+		session->budget = 0;
+	}
+}
+
+//
+// Whether window position `x, y` is on the grid of copies of the tiled
+// frame.
+//
+static bool tilingWithin(struct sprite *s, int x, int y)
+{
+	if (!session->tiling)
+		return false;
+
+	int k  = session->tiling / 2,
+	    fw = s->fw * session->zoom,
+	    fh = s->fh * session->zoom,
+	    x0 = session->x + (min(session->tiled, s->nframes - 1) - k) * fw,
+	    y0 = session->y - k * fh;
+
+	return x0 <= x && x < x0 + session->tiling * fw &&
+		y0 <= y && y < y0 + session->tiling * fh;
+}
+
+static void spriteStartDrawing(struct sprite *s, int x, int y)
+{
+	if (!spriteWithinBoundary(s, x, y) && !tilingWithin(s, x, y))
+		return;
+
+	spriteDraw(s, x, y);
+	session->tool.u.brush.drawing = DRAW_STARTED;
+}
+
+static void spriteStopDrawing(struct sprite *s)
+{
+	session->tool.u.brush.drawing = DRAW_ENDED;
+	spriteSnapshot(s);
+}
+
+//
+// Read back the screen pixel at the pick point, as it was drawn this frame.
+// The color arrives on a later frame, through `pollSample`, so picking
+// never waits for the GPU.
+//
+static void sample(void)
+{
+	struct point p = session->pick;
+
+	if (p.x < 0)
+		return;
+
+	session->readback = readbackStart(session->readback, p.x, session->h - p.y - 1, 1, 1);
+	session->pick     = point(-1, -1);
+}
+
+static void pollSample(void)
+{
+	struct rgba pixel;
+
+	if (readbackPoll(session->readback, (uint8_t *)&pixel))
+		setFgColor(pixel);
+}
+
+static void setFgColor(struct rgba color)
+{
+	session->fg = color;
+	paletteAddColor(0, 0, session->fg);
+}
+
+static void pickColor(int x, int y)
+{
+	session->pick = point(x, y);
+}
+
+static void paletteAddColor(int x, int y, struct rgba color)
+{
+	fillRect(x, y, x + palette->size, y + palette->size, color);
+}
+
+static void marquee(GLFWwindow *_, const union arg *arg)
+{
+	session->tool.curr            = TOOL_MARQUEE;
+	session->tool.u.marquee.state = MARQUEE_NONE;
+	session->tool.u.marquee.min.x = -1;
+	session->tool.u.marquee.min.y = -1;
+	session->tool.u.marquee.max.x = -1;
+	session->tool.u.marquee.max.y = -1;
+}
+
+static void wand(GLFWwindow *_w, const union arg *_a)
+{
+	session->tool.curr = TOOL_WAND;
+}
+
+//
+// Switch brush symmetry to the mode in `arg->i`, or off if it is already on.
+//
+static void symmetry(GLFWwindow *_, const union arg *arg)
+{
+	session->symmetry = session->symmetry == (enum symmetry)arg->i ? SYMMETRY_NONE : arg->i;
+}
+
+//
+// Change the number of copies made by radial symmetry by `arg->i`.
+//
+static void folds(GLFWwindow *_, const union arg *arg)
+{
+	session->folds = max(2, min(SYMMETRY_MAX_FOLDS, session->folds + arg->i));
+}
+
+//
+// Select the shape tool, drawing the shape in `arg->i`, eg. SHAPE_ELLIPSE.
+// Selecting the shape that is already selected switches it between outline
+// and filled.
+//
+static void shape(GLFWwindow *_, const union arg *arg)
+{
+	struct shape *sh = &session->tool.u.shape;
+	bool fill = session->tool.curr == TOOL_SHAPE && sh->kind == (enum shapekind)arg->i && !sh->fill;
+
+	session->tool.curr = TOOL_SHAPE;
+	sh->kind           = arg->i;
+	sh->fill           = fill;
+	sh->dragging       = false;
+}
+
+//
+// Rasterize the shape being dragged, passing its spans to `fn`.
+//
+static void shapeRaster(const struct shape *sh, rasterspan fn, void *ctx)
+{
+	switch (sh->kind) {
+	case SHAPE_LINE:
+		rasterLine(sh->from.x, sh->from.y, sh->to.x, sh->to.y, fn, ctx);
+		break;
+	case SHAPE_RECT:
+		rasterRect(sh->from.x, sh->from.y, sh->to.x, sh->to.y, sh->fill, fn, ctx);
+		break;
+	case SHAPE_ELLIPSE:
+		rasterEllipse(sh->from.x, sh->from.y, sh->to.x, sh->to.y, sh->fill, fn, ctx);
+		break;
+	}
+}
+
+static void shapePaintSpan(int y, int x0, int x1, void *ctx)
+{
+	struct sprite *s = ctx;
+	struct rect parts[4];
+	int nparts = spriteWrap(s, rect(x0, y, x1, y + 1), true, parts);
+
+	for (int p = 0; p < nparts; p++) {
+		spriteBlendRect(s, parts[p], session->fg, BLEND_NORMAL);
+	}
+}
+
+//
+// Paint the shape that was dragged onto the active layer, as one undo step.
+//
+static void spriteShape(struct sprite *s)
+{
+	spriteCommit(s);
+	spriteSelection(s);
+	shapeRaster(&session->tool.u.shape, shapePaintSpan, s);
+	spriteSnapshot(s);
+}
+
+//
+// Select the whole sheet, or nothing if `arg->i` is zero.
+//
+static void selectAll(GLFWwindow *_, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+	struct mask *m = maskNew(s->fw * s->nframes, s->fh);
+
+	if (arg->i)
+		maskFill(m);
+
+	spriteSelect(s, m, MASK_REPLACE);
+}
+
+static void invertSelection(GLFWwindow *_w, const union arg *_a)
+{
+	struct sprite *s = session->sprite;
+	struct mask *m = maskNew(s->fw * s->nframes, s->fh);
+
+	if (spriteSelection(s))
+		maskCombine(m, session->selection, MASK_REPLACE);
+
+	maskInvert(m);
+	spriteSelect(s, m, MASK_REPLACE);
+}
+
+//
+// Fill the selection with the foreground color, or clear it if `arg->i` is
+// zero. Without a selection, nothing happens.
+//
+static void fillSelection(GLFWwindow *_, const union arg *arg)
+{
+	struct sprite *s = session->sprite;
+	struct rect r;
+
+	if (!spriteSelection(s) || !maskBounds(session->selection, &r.x0, &r.y0, &r.x1, &r.y1))
+		return;
+
+	spriteCommit(s);
+	spriteFillRect(s, r, arg->i ? session->fg : TRANSPARENT);
+	spriteSnapshot(s);
+}
+
+static void center()
+{
+	int cx, cy;
+
+	cx  = session->w/2;
+	cy  = session->h/2;
+
+	// TODO(cloudhead): use total width of all frames in sprite.
+	cx -= session->sprite->fw/2 * session->zoom;
+	cy -= session->sprite->fh/2 * session->zoom;
+
+	session->x = cx + session->offx;
+	session->y = cy + session->offy;
+
+	session->x -= session->x % session->zoom;
+	session->y -= session->y % session->zoom;
+}
+
+static void reset()
+{
+	session->offx = 0;
+	session->offy = 0;
+
+	center();
+}
+
+static void move(GLFWwindow *_, const union arg *arg)
+{
+	session->offx += arg->p.x;
+	session->offy += arg->p.y;
+
+	center();
+}
+
+bool onionMode;
+static void onion(GLFWwindow *win, const union arg *arg)
+{
+	if (arg->b) {
+		onionMode = true;
+	} else {
+		onionMode = false;
+	}
+}
+
+static struct point* pan_offset;
+static void pan(GLFWwindow *win, const union arg *arg)
+{
+	if (arg->b) {
+		double x, y;
+		glfwGetCursorPos(win, &x, &y);
+		pan_offset    = malloc(sizeof *pan_offset);
+		pan_offset->x = (int)x;
+		pan_offset->y = (int)y;
+	} else {
+		free(pan_offset);
+		pan_offset = NULL;
+	}
+}
+
+static void fbSizeCallback(GLFWwindow *win, int w, int h)
+{
+	session->w = w;
+	session->h = h;
+
+	fbClear();
+	setupPalette();
+
+	if (session->sprite) // Still loading otherwise
+		center();
+}
+
+static void mouseButtonCallback(GLFWwindow *win, int button, int action, int mods)
+{
+	double x, y;
+
+	latencyInput(glfwGetTime());
+	glfwGetCursorPos(win, &x, &y);
+
+	switch (session->tool.curr) {
+	case TOOL_MULTI:
+	case TOOL_BRUSH: {
+			if (action == GLFW_PRESS) {
+				spriteStartDrawing(session->sprite, floor(x), floor(y));
+			} else if (action == GLFW_RELEASE) {
+				spriteStopDrawing(session->sprite);
+			}
+		}
+		break;
+	case TOOL_MARQUEE: {
+			struct marquee *m = &session->tool.u.marquee;
+
+			struct sprite *s = session->sprite;
+			int sx = (floor(x) - session->x) / session->zoom,
+			    sy = (floor(y) - session->y) / session->zoom;
+
+			if (m->state == MARQUEE_STARTED && action == GLFW_RELEASE) {
+				m->state = MARQUEE_ENDED;
+				spriteSelectRect(s, marqueeRect(s), m->op);
+			} else if (m->state == MARQUEE_CUT && action == GLFW_RELEASE) {
+				m->state = MARQUEE_ENDED;
+			} else if (action == GLFW_PRESS && m->state == MARQUEE_ENDED && !mods && spriteWithinBoundary(s, x, y) &&
+			           spriteSelection(s) && maskGet(session->selection, sx, sy)) {
+				m->state = MARQUEE_CUT; // Move selection
+			} else if (action == GLFW_PRESS) {
+				m->min   = point(floor(x), floor(y));
+				m->max   = m->min;
+				m->op    = selectOp(mods);
+				m->state = MARQUEE_STARTED;
+			}
+		}
+		break;
+	case TOOL_SAMPLER: {
+			pickColor(round(x), round(y));
+		}
+		break;
+	case TOOL_WAND: {
+			if (action == GLFW_PRESS)
+				spriteSelectColor(session->sprite, floor(x), floor(y), mods & GLFW_MOD_CONTROL, selectOp(mods));
+		}
+		break;
+	case TOOL_SHAPE: {
+			struct shape *sh = &session->tool.u.shape;
+			struct sprite *s = session->sprite;
+
+			// The layer is only painted on once the shape is let go of.
+			if (action == GLFW_PRESS && (spriteWithinBoundary(s, x, y) || tilingWithin(s, x, y))) {
+				sh->from     = sheetPoint(floor(x), floor(y));
+				sh->to       = sh->from;
+				sh->dragging = true;
+			} else if (action == GLFW_RELEASE && sh->dragging) {
+				sh->dragging = false;
+				spriteShape(s);
+			}
+		}
+		break;
+	}
+}
+
+static void cursorPosCallback(GLFWwindow *win, double fx, double fy)
+{
+	int x = floor(fx),
+	    y = floor(fy);
+
+	latencyInput(glfwGetTime());
+
+	if (pan_offset) {
+		move(win, &(union arg){ .p = { x - pan_offset->x, y - pan_offset->y } });
+		pan_offset->x = x;
+		pan_offset->y = y;
+		return;
+	}
+
+	struct sprite *s = session->sprite;
+
+	switch (session->tool.curr) {
+	case TOOL_BRUSH:
+	case TOOL_MULTI:
+		if (session->tool.u.brush.drawing == DRAW_STARTED || session->tool.u.brush.drawing == DRAW_DRAWING) {
+			spriteDraw(s, x, y);
+			session->tool.u.brush.drawing = DRAW_DRAWING;
+		}
+		break;
+	case TOOL_MARQUEE:
+		if (session->tool.u.marquee.state == MARQUEE_STARTED) {
+			session->tool.u.marquee.max = snap(point(x, y));
+		} else if (session->tool.u.marquee.state == MARQUEE_CUT) {
+		}
+		break;
+	case TOOL_SHAPE:
+		if (session->tool.u.shape.dragging)
+			session->tool.u.shape.to = sheetPoint(x, y);
+		break;
+	default:
+		break;
+	}
+}
+
+//
+// Draw the palette colors in a column along the left edge of the window,
+// wrapping into more columns when they would get too small to pick.
+//
+static void setupPalette()
+{
+	int ncolors = palette->ncolors;
+	int rows = max(1, min(ncolors, session->h / PALETTE_MIN_SIZE)),
+	    cols = (ncolors + rows - 1) / rows;
+	int s = palette->size = max(1, session->h / rows);
+	int stride = cols * s * sizeof(struct rgba);
+
+	palette->h = session->h;
+	palette->pixels = realloc(palette->pixels, palette->h * stride);
+	memset(palette->pixels, 0, palette->h * stride);
+
+	if (palette->texture)
+		textureDelete(palette->texture);
+
+	palette->texture = textureGen(cols * s, palette->h, palette->pixels);
+
+	fbAttach(palette->fb, palette->texture);
+	glBindFramebuffer(GL_FRAMEBUFFER, palette->fb);
+
+	fbClear();
+
+	for (int i = 0; i < ncolors; i++) {
+		paletteAddColor((i / rows) * s, (i % rows) * s, palette->colors[i]);
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-static void paletteAddColor(int x, int y, struct rgba color)
+//
+// Make the `n` colors the active palette. Takes ownership of `colors`.
+//
+static void paletteSet(struct rgba *colors, int n)
 {
-	fillRect(x, y, x + palette->size, y + palette->size, color);
+	free(palette->colors);
+	nearestFree(palette->nearest);
+
+	palette->colors  = colors;
+	palette->ncolors = n;
+	palette->nearest = nearestBuild(colors, n);
+
+	if (palette->texture)
+		setupPalette();
 }
 
-static void marquee(GLFWwindow *_, const union arg *arg)
+static void brushSize(GLFWwindow *_, const union arg *arg)
 {
-	session->tool.curr            = TOOL_MARQUEE;
-	session->tool.u.marquee.state = MARQUEE_NONE;
-	session->tool.u.marquee.min.x = -1;
-	session->tool.u.marquee.min.y = -1;
-	session->tool.u.marquee.max.x = -1;
-	session->tool.u.marquee.max.y = -1;
+	session->tool.u.brush.size += arg->i;
+
+	if (session->tool.u.brush.size < 1)
+		session->tool.u.brush.size = 1;
 }
 
-static void center()
+static void zoom(GLFWwindow *_, const union arg *arg)
 {
-	int cx, cy;
+	session->zoom += arg->i;
 
-	cx  = session->w/2;
-	cy  = session->h/2;
+	if (session->zoom < 1)
+		session->zoom = 1;
 
-	// TODO(cloudhead): use total width of all frames in sprite.
-	cx -= session->sprite->fw/2 * session->zoom;
-	cy -= session->sprite->fh/2 * session->zoom;
+	center();
+	fbClear();
+}
 
-	session->x = cx + session->offx;
-	session->y = cy + session->offy;
+static void grid(GLFWwindow *_, const union arg *arg)
+{
+	session->grid += arg->i;
 
-	session->x -= session->x % session->zoom;
-	session->y -= session->y % session->zoom;
+	if (session->grid < 0)
+		session->grid = 0;
 }
 
-static void reset()
+//
+// Toggle the tiling preview of the frame under the cursor, with `arg->i`
+// copies across and down. While tiling, strokes and fills wrap around the
+// frame's edges, so that it tiles seamlessly.
+//
+static void tiling(GLFWwindow *win, const union arg *arg)
 {
-	session->offx = 0;
-	session->offy = 0;
+	if (session->tile)
+		textureDelete(session->tile);
 
-	center();
+	session->tile   = NULL;
+	session->tiling = session->tiling == arg->i ? 0 : arg->i;
+	session->tiled  = cursorFrame(win);
 }
 
-static void move(GLFWwindow *_, const union arg *arg)
+static void windowClose(GLFWwindow *win, const union arg *_)
 {
-	session->offx += arg->p.x;
-	session->offy += arg->p.y;
+	glfwSetWindowShouldClose(win, GL_TRUE);
+}
 
-	center();
+static void adjustFPS(GLFWwindow *_, const union arg *arg)
+{
+	session->fps += arg->i;
+
+	if (session->fps < 1)
+		session->fps = 1;
 }
 
-bool onionMode;
-static void onion(GLFWwindow *win, const union arg *arg)
+static void pause()
 {
-	if (arg->b) {
-		onionMode = true;
+	session->paused = !session->paused;
+}
+
+//
+// Save the sheet to `filename`, either with its layers, or flattened into
+// a plain image. The format is the one of the sheet's own file.
+//
+static int saveTo(const char *filename, bool flatten)
+{
+	struct sprite *s = session->sprite;
+	struct tga *t = (struct tga *)s->image;
+	struct rgba *tmp;
+	char id[256] = "";
+
+	int w = s->fw * s->nframes;
+	int h = s->fh;
+
+	char depth = t ? t->depth : 32;
+
+	int err;
+
+	if (flatten) {
+		tmp = spriteFlatten(s);
 	} else {
-		onionMode = false;
+		tmp = spriteReadPixels(s);
+		h   = s->fh * s->nlayers;
+
+		spriteDescribe(s, id, sizeof(id));
+
+		if (s->nlayers > 1) // Layers need their alpha
+			depth = 32;
+	}
+	if (w > SHEET_MAX || h > SHEET_MAX) {
+		debug("error: %dx%d is too large to save to '%s'", w, h, filename);
+		free(tmp);
+		return -1;
+	}
+	// Paths without a known extension, like copies, keep the format of the sheet.
+	const char *ext = strrchr(filename, '.');
+
+	if (pathIsPNG(ext && (!strcmp(ext, ".tga") || pathIsPNG(ext)) ? filename : session->filepath))
+		err = pngEncode((uint32_t *)tmp, w, h, PNG_LEVEL, id, filename);
+	else
+		err = tgaEncode((uint32_t *)tmp, w, h, depth, id, filename);
+
+	if (err != 0) {
+		debug("error: unable to save copy to '%s'", filename);
 	}
+	free(tmp);
+
+	return err;
 }
 
-static struct point* pan_offset;
-static void pan(GLFWwindow *win, const union arg *arg)
+static void stats()
 {
-	if (arg->b) {
-		double x, y;
-		glfwGetCursorPos(win, &x, &y);
-		pan_offset    = malloc(sizeof *pan_offset);
-		pan_offset->x = (int)x;
-		pan_offset->y = (int)y;
+	struct tilestats t = tileStats();
+	struct sprite *s = session->sprite;
+	size_t pages = 0, textures = 0;
+	int ntiles = 0;
+
+	for (int i = 0; i < s->capacity; i++) {
+		for (int l = 0; l < s->nlayers; l++) {
+			pages += pageBytes(s->layers[l].pages[i]);
+			ntiles += s->layers[l].pages[i] ? s->layers[l].pages[i]->ntiles : 0;
+		}
+		pages += pageBytes(s->below[i]);
+	}
+	for (int i = 0; i < s->capacity * s->tcols * s->trows; i++) {
+		if (s->tiles[i])
+			textures += (size_t)s->tiles[i]->w * s->tiles[i]->h * sizeof(struct rgba);
+	}
+	debug("canvas: %zuK in %d pixel tiles, %zuK of textures, for %zuK of pixels",
+		pages / 1024, ntiles, textures / 1024,
+		(size_t)s->fw * s->fh * s->nframes * s->nlayers * sizeof(struct rgba) / 1024);
+
+	debug("history: %zu tiles, %zu refs, %zuK stored for %zuK of pixels (%.1fx dedup)",
+		t.unique, t.refs, t.bytes / 1024, t.logical / 1024,
+		t.bytes ? (double)t.logical / t.bytes : 1.0);
+	struct memstats m = memoryStats();
+	size_t total = m.canvas + m.textures + m.history + m.palette;
+
+	debug("memory: %zuK in total, %zuK canvas, %zuK textures, %zuK history, %zuK palette, %zuK history on disk",
+		total / 1024, m.canvas / 1024, m.textures / 1024, m.history / 1024, m.palette / 1024, m.spilled / 1024);
+	if (session->budget)
+		debug("memory: budget %zuM, %.0f%% used", session->budget >> 20, 100.0 * total / session->budget);
+	if (session->history)
+		debug("history file: %ldK, %u tiles", session->history->size / 1024, session->history->ntiles);
+
+	debug("blending: %s kernel", blendKernel());
+	printLatency();
+}
+
+static void printLatency()
+{
+	struct latencystats l = latencyStats();
+
+	if (!l.count)
+		return;
+
+	debug("latency: %lu inputs, mean %.1fms, p50 %.1fms, p90 %.1fms, p99 %.1fms, max %.1fms (vsync %s, fence %s)",
+		l.count, l.mean, l.p50, l.p90, l.p99, l.max, session->vsync ? "on" : "off", session->fence ? "on" : "off");
+
+	for (int r = 0; r < LATENCY_RANGES; r++) {
+		char line[64];
+
+		latencyRange(line, &l, r, 40);
+		debug("%s", line);
+	}
+}
+
+//
+// Format range `r` of the histogram as a bar of up to `width` characters.
+//
+static void latencyRange(char *line, struct latencystats *l, int r, int width)
+{
+	unsigned long most = 1;
+
+	for (int i = 0; i < LATENCY_RANGES; i++) {
+		most = max(most, l->ranges[i]);
+	}
+	int n = sprintf(line, "%s%3dms ", r < LATENCY_RANGES - 1 ? " <" : ">=", 1 << min(r, LATENCY_RANGES - 2));
+	int bar = (int)((double)l->ranges[r] / most * width + 0.5);
+
+	memset(line + n, '#', bar);
+	sprintf(line + n + bar, " %lu", l->ranges[r]);
+}
+
+//
+// Show the latency histogram in the corner of the window.
+//
+static void drawLatency()
+{
+	struct latencystats l = latencyStats();
+	char line[64];
+	int y = session->h - GH * (LATENCY_RANGES + 3);
+
+	sprintf(line, "vsync %s  fence %s", session->vsync ? "on" : "off", session->fence ? "on" : "off");
+	drawGlyphs(line, session->w - strlen(line) * GW, y);
+
+	sprintf(line, "p50 %.1f  p99 %.1f  max %.1fms", l.p50, l.p99, l.max);
+	drawGlyphs(line, session->w - strlen(line) * GW, y += GH);
+
+	for (int r = 0; r < LATENCY_RANGES; r++) {
+		latencyRange(line, &l, r, 20);
+		drawGlyphs(line, session->w - 34 * GW, y += GH);
+	}
+}
+
+static void latency(GLFWwindow *_w, const union arg *_a)
+{
+	session->latency = !session->latency;
+}
+
+//
+// Toggle waiting for the GPU after each swap, so that latencies include
+// the time to draw. Both settings start a new histogram.
+//
+static void fence(GLFWwindow *_w, const union arg *_a)
+{
+	session->fence = !session->fence;
+	latencyReset();
+}
+
+static void vsync(GLFWwindow *_w, const union arg *_a)
+{
+	session->vsync = !session->vsync;
+	glfwSwapInterval(session->vsync);
+	latencyReset();
+}
+
+static void saveCopy()
+{
+	char filename[64];
+
+	sprintf(filename, "%s.%lu", session->filepath, time(NULL));
+	saveTo(filename, false);
+}
+
+static void save()
+{
+	// Once the sheet is safely on disk, the journal is no longer needed.
+	if (saveTo(session->filepath, false) == 0 && session->journal)
+		journalReset(session->journal);
+}
+
+//
+// Save the sheet with its layers flattened, next to the original, eg.
+// "sheet.png" is exported to "sheet-flat.png".
+//
+static void export()
+{
+	const char *path = session->filepath,
+	           *ext  = strrchr(path, '.');
+	int stem = ext && !strchr(ext, '/') ? ext - path : strlen(path);
+	const char *suffix = path[stem] ? path + stem : ".tga";
+	char *filename = malloc(stem + sizeof("-flat") + strlen(suffix));
+
+	sprintf(filename, "%.*s-flat%s", stem, path, suffix);
+
+	if (saveTo(filename, true) == 0)
+		debug("exported '%s'", filename);
+
+	free(filename);
+}
+
+//
+// Export the flattened frames trimmed, without duplicates, and packed into
+// an atlas, along with a JSON file with where each frame went and how long
+// it's shown.
+//
+static void exportAtlas()
+{
+	struct sprite *s = session->sprite;
+	const char *path = session->filepath,
+	           *ext  = strrchr(path, '.');
+	int stem = ext && !strchr(ext, '/') ? ext - path : strlen(path);
+	const char *suffix = path[stem] ? path + stem : ".tga";
+	char *image = malloc(stem + sizeof("-atlas") + strlen(suffix)),
+	     *meta  = malloc(stem + sizeof("-atlas.json"));
+
+	sprintf(image, "%.*s-atlas%s", stem, path, suffix);
+	sprintf(meta, "%.*s-atlas.json", stem, path);
+
+	struct rgba *pixels = spriteFlatten(s);
+	struct atlas *a = atlasBuild(pixels, s->fw, s->fh, s->nframes, 1000 / session->fps, ATLAS_PADDING);
+
+	free(pixels);
+
+	if (!a) {
+		debug("error: frames don't fit in an atlas");
 	} else {
-		free(pan_offset);
-		pan_offset = NULL;
+		// The metadata refers to the image relative to itself.
+		const char *name = strrchr(image, '/') ? strrchr(image, '/') + 1 : image;
+		int err = pathIsPNG(image) ? pngEncode((uint32_t *)a->pixels, a->w, a->h, PNG_LEVEL, "", image)
+		                           : tgaEncode((uint32_t *)a->pixels, a->w, a->h, 32, "", image);
+
+		if (err != 0 || atlasWrite(a, name, meta) != 0)
+			debug("error: unable to export atlas to '%s'", image);
+		else
+			debug("exported '%s', %d of %d frames in %dx%d", image, a->unique, s->nframes, a->w, a->h);
 	}
+	atlasFree(a);
+	free(image);
+	free(meta);
 }
 
-static void fbSizeCallback(GLFWwindow *win, int w, int h)
+static void keyCallback(GLFWwindow *win, int key, int scancode, int action, int mods)
 {
-	session->w = w;
-	session->h = h;
+	latencyInput(glfwGetTime());
 
-	fbClear();
-	setupPalette();
-	center();
+	for (int i = 0; i < LENGTH(bindings); i++) {
+		if (bindings[i].key == key
+			&& bindings[i].mods == mods
+			&& bindings[i].action == action
+			&& bindings[i].callback) {
+			bindings[i].callback(win, &(bindings[i].arg));
+			return;
+		}
+	}
+	// While the brush is held, Ctrl samples and Shift paints every frame.
+	// Other tools take the modifiers for themselves, eg. to add to or
+	// intersect a selection.
+	if (key == GLFW_KEY_LEFT_CONTROL || key == GLFW_KEY_LEFT_SHIFT) {
+		enum tool held = key == GLFW_KEY_LEFT_CONTROL ? TOOL_SAMPLER : TOOL_MULTI;
+
+		if (action == GLFW_PRESS && session->tool.curr == TOOL_BRUSH)
+			session->tool.curr = held;
+		else if (action == GLFW_RELEASE && session->tool.curr == held)
+			session->tool.curr = TOOL_BRUSH;
+	}
 }
 
-static void mouseButtonCallback(GLFWwindow *win, int button, int action, int mods)
+static void boundaryDraw(struct rgba color, int x1, int y1, int x2, int y2)
 {
-	double x, y;
+	glColor4ubv((GLubyte*)&color);
+	glBegin(GL_LINE_LOOP);
+	glVertex3f(x1 - 0.5, y1 - 0.5, 0);
+	glVertex3f(x2 + 0.5, y1 - 0.5, 0);
+	glVertex3f(x2 + 1.0, y2 + 0.5, 0);
+	glVertex3f(x1 - 0.5, y2 + 0.5, 0);
+	glEnd();
+}
 
-	glfwGetCursorPos(win, &x, &y);
+//
+// Compute the part of the sheet that intersects the window, in sheet pixels.
+// Returns false if none of it is visible.
+//
+static bool spriteVisibleRect(struct sprite *s, struct point *lo, struct point *hi)
+{
+	int z = session->zoom;
 
-	switch (session->tool.curr) {
-	case TOOL_MULTI:
-	case TOOL_BRUSH: {
-			if (action == GLFW_PRESS) {
-				spriteStartDrawing(session->sprite, floor(x), floor(y));
-			} else if (action == GLFW_RELEASE) {
-				spriteStopDrawing(session->sprite);
-			}
+	lo->x = max(0, (int)floor((double)-session->x / z));
+	lo->y = max(0, (int)floor((double)-session->y / z));
+	hi->x = min(s->fw * s->nframes, (int)ceil((double)(session->w - session->x) / z));
+	hi->y = min(s->fh, (int)ceil((double)(session->h - session->y) / z));
+
+	return lo->x < hi->x && lo->y < hi->y;
+}
+
+//
+// Draw the part `r` of slot `slot`, in frame coordinates, at `x, y`. Only
+// the render tiles that intersect `r` are drawn, and transparent ones have
+// no texture to draw.
+//
+static void spriteDrawSlot(struct sprite *s, int slot, struct rect r, int x, int y)
+{
+	for (int ty = r.y0 - r.y0 % RENDER_TILE; ty < r.y1; ty += RENDER_TILE) {
+		for (int tx = r.x0 - r.x0 % RENDER_TILE; tx < r.x1; tx += RENDER_TILE) {
+			struct texture *t = *spriteTile(s, slot, tx, ty);
+			int x0 = max(tx, r.x0), x1 = min(tx + RENDER_TILE, r.x1),
+			    y0 = max(ty, r.y0), y1 = min(ty + RENDER_TILE, r.y1);
+
+			if (t)
+				textureDrawRect(t, x0 - tx, y0 - ty, x1 - x0, y1 - y0, x + x0 - r.x0, y + y0 - r.y0);
 		}
-		break;
-	case TOOL_MARQUEE: {
-			struct marquee *m = &session->tool.u.marquee;
+	}
+}
 
-			if (m->state == MARQUEE_STARTED && action == GLFW_RELEASE) {
-				m->state = MARQUEE_ENDED;
-			} else if (m->state == MARQUEE_ENDED) { // Move selection
-				if (action == GLFW_PRESS) {
-					m->state = MARQUEE_CUT;
-				} else {
-					m->state = MARQUEE_ENDED;
+//
+// Draw the part `r` of the sheet at `x, y`, going through the frame table.
+//
+static void spriteDrawRect(struct sprite *s, struct rect r, int x, int y)
+{
+	for (int f = r.x0 / s->fw; f * s->fw < r.x1; f++) {
+		int fx = f * s->fw,
+		    x0 = max(r.x0, fx),
+		    x1 = min(r.x1, fx + s->fw);
+
+		spriteDrawSlot(s, s->frames[f], rect(x0 - fx, r.y0, x1 - fx, r.y1), x + x0 - r.x0, y);
+	}
+}
+
+//
+// Draw the part of the sheet that is in the window, so that the cost
+// depends on the window and not the sheet size. Must be called with the
+// sheet's transform applied.
+//
+static void spriteDrawVisible(struct sprite *s)
+{
+	struct point lo, hi;
+
+	if (spriteVisibleRect(s, &lo, &hi))
+		spriteDrawRect(s, rect(lo.x, lo.y, hi.x, hi.y), lo.x, lo.y);
+}
+
+static void overlayInit()
+{
+	if (!(overlay.program = shaderProgram(overlayVert, overlayFrag))) {
+		debug("warning: couldn't compile overlay shader, grid is disabled");
+		return;
+	}
+	overlay.fw      = glGetUniformLocation(overlay.program, "fw");
+	overlay.zoom    = glGetUniformLocation(overlay.program, "zoom");
+	overlay.spacing = glGetUniformLocation(overlay.program, "spacing");
+}
+
+static void adjustInit()
+{
+	if (!(adjust.program = shaderProgram(adjustVert, adjustFrag))) {
+		debug("warning: couldn't compile color adjustment shader, preview is disabled");
+		return;
+	}
+	adjust.n    = glGetUniformLocation(adjust.program, "n");
+	adjust.side = glGetUniformLocation(adjust.program, "side");
+
+	glUseProgram(adjust.program);
+	glUniform1i(glGetUniformLocation(adjust.program, "sheet"), 0);
+	glUniform1i(glGetUniformLocation(adjust.program, "keys"), 1);
+	glUniform1i(glGetUniformLocation(adjust.program, "values"), 2);
+	glUseProgram(0);
+}
+
+//
+// Compute what the collected colors become with the current adjustments,
+// and send them to the GPU. Costs nothing per pixel.
+//
+static void adjustUpdate()
+{
+	struct colormap *m = adjust.map;
+
+	if (!m || !m->n)
+		return;
+
+	colormapBuild(m, &adjust.params, palette->colors, palette->ncolors);
+
+	adjust.palette = palette->colors;
+	adjust.ncolors = palette->ncolors;
+
+	int w = adjust.width, rows = (m->n + w - 1) / w;
+
+	memcpy(textureMap(w * rows * sizeof(*m->values)), m->values, m->n * sizeof(*m->values));
+	textureUnmap(adjust.values, 0, 0, w, rows);
+}
+
+//
+// Whether the pixels within `r`, which were just painted on, have colors the
+// table doesn't have.
+//
+static bool adjustMissing(struct sprite *s, struct rect r)
+{
+	if (adjust.map->n == COLORMAP_MAX) // Others are ignored anyway
+		return false;
+
+	for (int f = max(r.x0 / s->fw, 0); f < s->nframes && f * s->fw < r.x1; f++) {
+		int x0 = max(r.x0 - f * s->fw, 0), x1 = min(r.x1 - f * s->fw, s->fw),
+		    y0 = max(r.y0, 0),             y1 = min(r.y1, s->fh),
+		    w  = x1 - x0, h = y1 - y0;
+
+		if (w <= 0 || h <= 0)
+			continue;
+
+		struct rgba *px = malloc(w * h * sizeof(*px));
+
+		for (int l = 0; l < s->nlayers; l++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
+
+			if (!page || pageEmpty(page, x0, y0, w, h))
+				continue;
+
+			pageRead(page, x0, y0, w, h, px, w);
+
+			for (int i = 0; i < w * h; i++) {
+				if (px[i].a && colormapFind(adjust.map, px[i]) < 0) {
+					free(px);
+					return true;
 				}
-			} else {
-				m->min.x = floor(x);
-				m->min.y = floor(y);
-				m->state = MARQUEE_STARTED;
 			}
 		}
-		break;
-	case TOOL_SAMPLER: {
-			pickColor(round(x), round(y));
+		free(px);
+	}
+	return false;
+}
+
+//
+// Whether the composite only has the colors of the layers, so that looking
+// them up in the preview gives what applying the table to the layers does:
+// visible layers must be drawn as they are, and where there are several,
+// none may be partly transparent. Warns the first time it doesn't.
+//
+static void adjustCheck(struct sprite *s)
+{
+	bool exact   = true;
+	int  visible = 0;
+
+	for (int l = 0; l < s->nlayers; l++) {
+		struct layer *ly = &s->layers[l];
+
+		if (ly->visible) {
+			exact = exact && ly->blend == BLEND_NORMAL && ly->opacity == 255;
+			visible++;
 		}
-		break;
 	}
+	exact = exact && (visible < 2 || !adjust.map->partial);
+
+	if (adjust.exact && !exact)
+		debug("warning: layers blend into colors of their own, the color adjustment preview differs from the result there");
+
+	adjust.exact = exact;
 }
 
-static void cursorPosCallback(GLFWwindow *win, double fx, double fy)
+//
+// Collect the colors of every layer of `s`, unless they were collected at
+// the current undo state already: the table only changes with the pixels,
+// and `spriteFlush` drops it when new colors are painted.
+//
+static void adjustCollect(struct sprite *s)
 {
-	int x = floor(fx),
-	    y = floor(fy);
+	struct tile **tiles = s->snapshot >= 0 ? s->snapshots[s->snapshot].tiles : NULL;
 
-	if (pan_offset) {
-		move(win, &(union arg){ .p = { x - pan_offset->x, y - pan_offset->y } });
-		pan_offset->x = x;
-		pan_offset->y = y;
+	if (adjust.map && adjust.sprite == s && adjust.snapshot == s->snapshot && adjust.tiles == tiles) {
+		if (adjust.palette != palette->colors || adjust.ncolors != palette->ncolors)
+			adjustUpdate();
+		adjustCheck(s);
 		return;
 	}
+	struct colormap *m = colormapNew();
+	bool complete = true;
 
-	struct sprite *s = session->sprite;
+	for (int l = 0; l < s->nlayers && complete; l++) {
+		for (int f = 0; f < s->nframes && complete; f++) {
+			struct page *page = s->layers[l].pages[s->frames[f]];
 
-	switch (session->tool.curr) {
-	case TOOL_BRUSH:
-	case TOOL_MULTI:
-		if (session->tool.u.brush.drawing == DRAW_STARTED || session->tool.u.brush.drawing == DRAW_DRAWING) {
-			spriteDraw(s, x, y);
-			session->tool.u.brush.drawing = DRAW_DRAWING;
-		}
-		break;
-	case TOOL_MARQUEE:
-		if (session->tool.u.marquee.state == MARQUEE_STARTED) {
-			session->tool.u.marquee.max = snap(point(x, y));
-		} else if (session->tool.u.marquee.state == MARQUEE_CUT) {
+			for (int i = 0; page && i < page->cols * page->rows && complete; i++) {
+				if (page->tiles[i])
+					complete = colormapAdd(m, page->tiles[i], PAGE_TILE * PAGE_TILE);
+			}
 		}
-		break;
-	default:
-		break;
 	}
-}
+	if (!complete)
+		debug("warning: sheet has more than %d colors, the others aren't adjusted", COLORMAP_MAX);
 
-static void setupPalette()
-{
-	int x = 0, y = 0;
-	int ncolors = 32;
-	int s = palette->size = floor((float)session->h / (float)ncolors);
-	int stride = s * sizeof(struct rgba);
+	colormapSort(m);
+	colormapFree(adjust.map);
 
-	palette->h = session->h;
-	palette->pixels = realloc(palette->pixels, palette->h * stride);
-	memset(palette->pixels, 0, palette->h * stride);
+	adjust.map      = m;
+	adjust.sprite   = s;
+	adjust.snapshot = s->snapshot;
+	adjust.tiles    = tiles;
 
-	if (palette->texture)
-		glDeleteTextures(1, &palette->texture->id);
+	adjustCheck(s);
 
-	palette->texture = textureGen(s, palette->h, palette->pixels);
+	if (!m->n)
+		return;
 
-	fbAttach(palette->fb, palette->texture);
-	glBindFramebuffer(GL_FRAMEBUFFER, palette->fb);
+	int w = 1;
 
-	fbClear();
+	while (w * w < m->n)
+		w *= 2;
 
-	for (int i = 0; i < ncolors; i++) {
-		paletteAddColor(x, y,
-			hsla2rgba((struct hsla){i * 1.0f/(float)ncolors, 0.5, 0.5, 1.0})
-		);
-		y += s;
+	if (w != adjust.width || !adjust.keys) {
+		if (adjust.keys) {
+			textureDelete(adjust.keys);
+			textureDelete(adjust.values);
+		}
+		adjust.keys   = textureGen(w, w, NULL);
+		adjust.values = textureGen(w, w, NULL);
+		adjust.width  = w;
 	}
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
-}
+	// Texels past the last color are never matched, and are left as is.
+	int rows = (m->n + w - 1) / w;
+	struct rgba *texels = (struct rgba *)textureMap(w * rows * sizeof(*texels));
 
-static void brushSize(GLFWwindow *_, const union arg *arg)
-{
-	session->tool.u.brush.size += arg->i;
+	for (int i = 0; i < m->n; i++)
+		texels[i] = rgba(m->keys[i] >> 16, m->keys[i] >> 8 & 0xff, m->keys[i] & 0xff, 255);
 
-	if (session->tool.u.brush.size < 1)
-		session->tool.u.brush.size = 1;
+	textureUnmap(adjust.keys, 0, 0, w, rows);
+	adjustUpdate();
 }
 
-static void zoom(GLFWwindow *_, const union arg *arg)
+//
+// Start drawing the sheet through the color adjustments, if they are being
+// previewed. Returns whether `adjustEnd` must be called.
+//
+static bool adjustBegin(struct sprite *s)
 {
-	session->zoom += arg->i;
+	if (!adjust.on || !adjust.program)
+		return false;
 
-	if (session->zoom < 1)
-		session->zoom = 1;
+	adjustCollect(s);
 
-	center();
-	fbClear();
-}
+	if (!adjust.map->n)
+		return false;
 
-static void windowClose(GLFWwindow *win, const union arg *_)
-{
-	glfwSetWindowShouldClose(win, GL_TRUE);
-}
+	glUseProgram(adjust.program);
+	glUniform1f(adjust.n, adjust.map->n);
+	glUniform1f(adjust.side, adjust.width);
 
-static void adjustFPS(GLFWwindow *_, const union arg *arg)
-{
-	session->fps += arg->i;
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, adjust.keys->id);
+	glActiveTexture(GL_TEXTURE2);
+	glBindTexture(GL_TEXTURE_2D, adjust.values->id);
+	glActiveTexture(GL_TEXTURE0);
 
-	if (session->fps < 1)
-		session->fps = 1;
+	return true;
 }
 
-static void pause()
+static void adjustEnd()
 {
-	session->paused = !session->paused;
+	glActiveTexture(GL_TEXTURE2);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE1);
+	glBindTexture(GL_TEXTURE_2D, 0);
+	glActiveTexture(GL_TEXTURE0);
+
+	glUseProgram(0);
 }
 
-static void saveTo(const char *filename)
+//
+// Draw `session->tiling` copies across and down of the tiled frame, centered
+// on it, over an opaque backdrop that hides the frames next to it. Must be
+// called with the sheet's transform applied.
+//
+static void drawTiling(struct sprite *s)
 {
-	struct sprite *s = session->sprite;
-	struct tga *t = (struct tga *)s->image;
-	struct rgba *tmp = spriteReadPixels(session->sprite);
+	if (!session->tiling || !session->tile)
+		return;
 
-	short w = s->fw * s->nframes;
-	short h = s->fh;
+	int n = session->tiling,
+	    k = n / 2,
+	    x = (min(session->tiled, s->nframes - 1) - k) * s->fw,
+	    y = -k * s->fh;
 
-	char depth = t ? t->depth : 32;
+	fillRect(x, y, x + n * s->fw, y + n * s->fh, BLACK);
 
-	if (tgaEncode((uint32_t *)tmp, w, h, depth, filename) != 0) {
-		debug("error: unable to save copy to '%s'", filename);
-	}
-	free(tmp);
+	// The texture repeats, so the copies are a single quad.
+	bool adjusted = adjustBegin(s);
+
+	glColor4f(1.0, 1.0, 1.0, 1.0);
+	textureDrawRect(session->tile, -k * s->fw, -k * s->fh, n * s->fw, n * s->fh, x, y);
+
+	if (adjusted)
+		adjustEnd();
 }
 
-static void saveCopy()
+static void shapePreviewSpan(int y, int x0, int x1, void *ctx)
 {
-	char filename[64];
+	struct rect *visible = ctx;
 
-	sprintf(filename, "%s.%lu", session->filepath, time(NULL));
-	saveTo(filename);
+	if (y >= visible->y0 && y < visible->y1)
+		fillRect(max(x0, visible->x0), y, min(x1, visible->x1), y + 1, session->fg);
 }
 
-static void save()
+//
+// Draw the shape being dragged, from the same spans it is painted with, so
+// that dragging doesn't touch the layer or the undo history. Rows outside
+// the window are skipped. Must be called with the sheet's transform applied.
+//
+static void drawShape(struct sprite *s)
 {
-	saveTo(session->filepath);
+	int z = session->zoom;
+
+	if (session->tool.curr != TOOL_SHAPE || !session->tool.u.shape.dragging)
+		return;
+
+	struct rect visible = rect(
+		(int)floor((double)-session->x / z),
+		(int)floor((double)-session->y / z),
+		(session->w - session->x) / z + 1,
+		(session->h - session->y) / z + 1
+	);
+	shapeRaster(&session->tool.u.shape, shapePreviewSpan, &visible);
 }
 
-static void keyCallback(GLFWwindow *win, int key, int scancode, int action, int mods)
+//
+// Draw the pixel grid, custom grid and frame boundaries over the visible
+// part of the sheet, in a single quad. Must be called with the sheet's
+// transform applied. At 100%, the overlay is drawn before the sheet, so
+// that boundaries only show behind transparent pixels.
+//
+static void drawOverlay(struct sprite *s)
 {
-	for (int i = 0; i < LENGTH(bindings); i++) {
-		if (bindings[i].key == key
-			&& bindings[i].mods == mods
-			&& bindings[i].action == action
-			&& bindings[i].callback) {
-			bindings[i].callback(win, &(bindings[i].arg));
-			return;
-		}
-	}
-	if (key == GLFW_KEY_LEFT_CONTROL) {
-		session->tool.curr = (action == GLFW_PRESS) ? TOOL_SAMPLER : TOOL_BRUSH;
-	}
-	if (key == GLFW_KEY_LEFT_SHIFT) {
-		session->tool.curr = (action == GLFW_PRESS) ? TOOL_MULTI : TOOL_BRUSH;
-	}
+	struct point lo, hi;
+
+	if (!overlay.program || !spriteVisibleRect(s, &lo, &hi))
+		return;
+
+	glUseProgram(overlay.program);
+	glUniform1f(overlay.fw, s->fw);
+	glUniform1f(overlay.zoom, session->zoom);
+	glUniform1f(overlay.spacing, session->grid);
+
+	glRecti(lo.x, lo.y, hi.x, hi.y);
+
+	glUseProgram(0);
 }
 
-static void boundaryDraw(struct rgba color, int x1, int y1, int x2, int y2)
+//
+// Tint the selected pixels of the sheet that are in the window, a run at
+// a time. Called with the sheet transform applied.
+//
+static void drawSelection(struct sprite *s)
 {
-	glColor4ubv((GLubyte*)&color);
-	glBegin(GL_LINE_LOOP);
-	glVertex3f(x1 - 0.5, y1 - 0.5, 0);
-	glVertex3f(x2 + 0.5, y1 - 0.5, 0);
-	glVertex3f(x2 + 1.0, y2 + 0.5, 0);
-	glVertex3f(x1 - 0.5, y2 + 0.5, 0);
-	glEnd();
+	struct point lo, hi;
+
+	if (!spriteSelection(s) || !spriteVisibleRect(s, &lo, &hi))
+		return;
+
+	for (int y = lo.y; y < hi.y; y++) {
+		for (int x = lo.x, n; (n = maskSpan(session->selection, y, &x, hi.x)) > 0; x += n) {
+			fillRect(x, y, x + n, y + 1, SELECTED);
+		}
+	}
 }
 
 static void drawBoundaries()
 {
 	struct sprite *s = session->sprite;
 
-	for (int i = 0; i < s->nframes; i++) {
+	int fw    = s->fw * session->zoom,
+	    first = max(0, -session->x / fw),
+	    last  = min(s->nframes - 1, (session->w - session->x) / fw);
+
+	if (overlay.program) // Frame boundaries are drawn by the overlay
+		first = last + 1;
+
+	for (int i = first; i <= last; i++) {
 		boundaryDraw(
 			DARKGREY,
-			session->x + i * s->fw * session->zoom,
+			session->x + i * fw,
 			session->y,
-			session->x + s->fw * session->zoom,
+			session->x + (i + 1) * fw,
 			session->y + s->fh * session->zoom
 		);
 	}
@@ -849,7 +4170,7 @@ static void drawBoundaries()
 
 static void createBlank()
 {
-	addSprite(sprite(64, 64, NULL, 0, 64));
+	addSprite(sprite(64, 64, 1, NULL, 64));
 	createFrame(NULL, NULL);
 }
 
@@ -865,30 +4186,282 @@ static void createFilename(char **filename)
 	sprintf(*filename, "%s.tga", timestr);
 }
 
+//
+// Callbacks that can be run from the command socket, by name.
+//
+#define CALLBACK(f) { #f, f }
+
+static const struct {
+	const char *name;
+	void       (*callback)(GLFWwindow *win, const union arg *arg);
+} callbacks[] = {
+	CALLBACK(createFrame), CALLBACK(insertFrame), CALLBACK(duplicateFrame), CALLBACK(deleteFrame),
+	CALLBACK(moveFrame), CALLBACK(reverseFrames), CALLBACK(frameTransform), CALLBACK(sheetTransform),
+	CALLBACK(remapColors), CALLBACK(preview), CALLBACK(adjustColors), CALLBACK(resetColors), CALLBACK(commitColors), CALLBACK(addLayer), CALLBACK(deleteLayer), CALLBACK(selectLayer),
+	CALLBACK(toggleLayer), CALLBACK(layerOpacity), CALLBACK(layerBlend), CALLBACK(saveCopy),
+	CALLBACK(save), CALLBACK(export), CALLBACK(exportAtlas), CALLBACK(stats), CALLBACK(latency), CALLBACK(fence),
+	CALLBACK(vsync), CALLBACK(zoom), CALLBACK(brushSize), CALLBACK(grid), CALLBACK(tiling), CALLBACK(undo),
+	CALLBACK(redo), CALLBACK(pause), CALLBACK(move), CALLBACK(brush), CALLBACK(marquee),
+	CALLBACK(wand), CALLBACK(shape), CALLBACK(symmetry), CALLBACK(folds), CALLBACK(selectAll), CALLBACK(invertSelection), CALLBACK(fillSelection),
+	CALLBACK(windowClose), CALLBACK(adjustFPS)
+};
+
+static int hexDigit(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+//
+// Parse `n` pixels written as RRGGBBAA, optionally separated by spaces.
+//
+static bool parsePixels(const char *str, struct rgba *out, int n)
+{
+	for (int i = 0; i < n; i++) {
+		uint8_t v[4];
+
+		while (*str == ' ')
+			str++;
+
+		for (int j = 0; j < 4; j++, str += 2) {
+			int hi = hexDigit(str[0]), lo = hi < 0 ? -1 : hexDigit(str[1]);
+
+			if (lo < 0)
+				return false;
+
+			v[j] = hi << 4 | lo;
+		}
+		out[i] = rgba(v[0], v[1], v[2], v[3]);
+	}
+	return *str == '\0';
+}
+
+static bool parseRect(struct sprite *s, int *x, int *y, int *w, int *h)
+{
+	char *tok[4];
+
+	for (int i = 0; i < 4; i++) {
+		if (!(tok[i] = strtok(NULL, " ")))
+			return false;
+	}
+	*x = atoi(tok[0]);
+	*y = atoi(tok[1]);
+	*w = atoi(tok[2]);
+	*h = atoi(tok[3]);
+
+	return *w > 0 && *h > 0 && *w <= s->fw * s->nframes && *h <= s->fh;
+}
+
+//
+// Run a command from the command socket. Commands are one per line, and
+// each gets a reply line starting with "ok" or "error". Coordinates are
+// sheet pixels, and pixels are written as RRGGBBAA hex.
+//
+//   size                         ok <fw> <fh> <frames> <layers> <active layer>
+//   get <x> <y> <w> <h>          ok <pixels>, from the active layer
+//   set <x> <y> <w> <h> <pixels> write to the active layer, clipped to the sheet
+//   fill <x> <y> <w> <h> <pixel>
+//   load <path> [<x> <y>]        paste an image on the active layer
+//   save [<path>]
+//   <callback> [<a> [<b>]]       any of `callbacks`, eg. "createFrame",
+//                                "selectLayer -1" or "move 0 50"
+//
+// Pixel commands don't take a snapshot each; whatever a frame's commands
+// change is one undo step.
+//
+static void command(struct cmdclient *c, char *line, void *win)
+{
+	struct sprite *s = session->sprite;
+	char *name = strtok(line, " "), *rest;
+	int x, y, w, h;
+
+	if (!name)
+		return;
+
+	if (!strcmp(name, "size")) {
+		cmdReply(c, "ok %d %d %d %d %d", s->fw, s->fh, s->nframes, s->nlayers, s->layer);
+	} else if (!strcmp(name, "get")) {
+		if (!parseRect(s, &x, &y, &w, &h) || x < 0 || y < 0 || x + w > s->fw * s->nframes || y + h > s->fh) {
+			cmdReply(c, "error: rectangle must be within the sheet");
+			return;
+		}
+		if ((size_t)w * h > COMMAND_PIXELS) {
+			cmdReply(c, "error: can't get more than %d pixels at once", COMMAND_PIXELS);
+			return;
+		}
+		struct rgba *pixels = malloc((size_t)w * h * sizeof(*pixels));
+		char *reply = malloc((size_t)w * h * 8 + 4), *p = reply;
+		static const char hex[] = "0123456789abcdef";
+
+		spriteReadRect(s, s->layer, rect(x, y, x + w, y + h), pixels);
+		p += sprintf(p, "ok ");
+
+		for (int i = 0; i < w * h; i++) {
+			uint8_t v[4] = { pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a };
+
+			for (int j = 0; j < 4; j++) {
+				*p++ = hex[v[j] >> 4];
+				*p++ = hex[v[j] & 15];
+			}
+		}
+		*p++ = '\n';
+		cmdWrite(c, reply, p - reply);
+
+		free(pixels);
+		free(reply);
+	} else if (!strcmp(name, "set") || !strcmp(name, "fill")) {
+		bool fill = name[0] == 'f';
+
+		if (!parseRect(s, &x, &y, &w, &h) || !(rest = strtok(NULL, ""))) {
+			cmdReply(c, "error: expected <x> <y> <w> <h> <pixels>");
+			return;
+		}
+		if (!fill && (size_t)w * h > COMMAND_PIXELS) {
+			cmdReply(c, "error: can't set more than %d pixels at once", COMMAND_PIXELS);
+			return;
+		}
+		struct rgba *pixels = malloc((fill ? 1 : (size_t)w * h) * sizeof(*pixels));
+
+		if (!parsePixels(rest, pixels, fill ? 1 : w * h)) {
+			cmdReply(c, "error: expected %d RRGGBBAA pixel(s)", fill ? 1 : w * h);
+		} else {
+			if (fill)
+				spriteFillRect(s, rect(x, y, x + w, y + h), pixels[0]);
+			else
+				spriteWriteRect(s, x, y, w, h, pixels);
+
+			cmdReply(c, "ok");
+		}
+		free(pixels);
+	} else if (!strcmp(name, "load")) {
+		char *path = strtok(NULL, " "), *sx = strtok(NULL, " "), *sy = strtok(NULL, " ");
+		struct tga *t;
+
+		if (!path || !(t = imageDecode(path))) {
+			cmdReply(c, "error: couldn't load image '%s': %s", path ? path : "", path ? strerror(errno) : "no path");
+			return;
+		}
+		x = sx ? atoi(sx) : 0;
+		y = sy ? atoi(sy) : 0;
+
+		spriteWriteRect(s, x, y, t->width, t->height, (struct rgba *)t->data);
+		cmdReply(c, "ok %d %d", t->width, t->height);
+
+		free(t->data);
+		free(t);
+	} else if (!strcmp(name, "save") && (rest = strtok(NULL, " "))) {
+		spriteCommit(s);
+
+		if (saveTo(rest, false) == 0)
+			cmdReply(c, "ok");
+		else
+			cmdReply(c, "error: couldn't save to '%s'", rest);
+	} else {
+		for (int i = 0; i < LENGTH(callbacks); i++) {
+			if (strcmp(name, callbacks[i].name))
+				continue;
+
+			char *a = strtok(NULL, " "), *b = strtok(NULL, " ");
+			union arg arg = { 0 };
+
+			if (b)
+				arg.p = point(atoi(a), atoi(b));
+			else if (a)
+				arg.i = atoi(a);
+
+			// Earlier pixel commands are their own undo step.
+			spriteCommit(s);
+			callbacks[i].callback(win, &arg);
+			cmdReply(c, "ok");
+			return;
+		}
+		cmdReply(c, "error: unknown command '%s'", name);
+	}
+}
+
+//
+// Draw a frame with `text` in the middle of the window, while the image is
+// loading.
+//
+static void drawLoading(GLFWwindow *window, const char *text)
+{
+	static bool shown;
+	int w, h;
+
+	glfwGetFramebufferSize(window, &w, &h);
+
+	glViewport(0, 0, w, h);
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	glOrtho(0.0, w, h, 0.0, -1.0, 1.0);
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity();
+
+	glEnable(GL_TEXTURE_2D);
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	glClearColor(0.0, 0.0, 0.0, 0.0);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	glColor4f(1.0, 1.0, 1.0, 1.0);
+	textureDraw(palette->texture, 0, 0);
+	drawGlyphs((char *)text, (session->w - (int)strlen(text) * GW) / 2, (session->h - GH) / 2);
+
+	glDisable(GL_BLEND);
+	glDisable(GL_TEXTURE_2D);
+	glFlush();
+	glfwSwapBuffers(window);
+
+	if (!shown) {
+		traceStartup("first frame", 0, glfwGetTime());
+		shown = true;
+	}
+}
+
 static void glyphsInit()
 {
-	glyphs = sprite(7, 14, (uint8_t *)glyphsData, 0, glyphsWidth);
+	glyphs = textureGen(glyphsWidth, GH, (uint8_t *)glyphsData);
 }
 
 int main(int argc, char *argv[])
 {
 	GLFWwindow* window;
+	struct load load;
+	double t0;
+
+	// Options come before the file names.
+	while (argc > 1 && !strncmp(argv[1], "--", 2)) {
+		if (strcmp(argv[1], "--trace-startup"))
+			fatal(" unknown option '%s'", argv[1]);
+
+		trace.on = true;
+		argv[1]  = argv[0];
+		argv++;
+		argc--;
+	}
 	glfwSetErrorCallback(errorCallback);
 
 	if (!glfwInit())
 		exit(1);
 
+	t0 = glfwGetTime();
 	window = glfwCreateWindow(640, 480, "px", NULL, NULL);
 	if (!window) {
 		glfwTerminate();
 		exit(1);
 	}
 	glfwMakeContextCurrent(window);
-	glfwSetKeyCallback(window, keyCallback);
-	glfwSetMouseButtonCallback(window, mouseButtonCallback);
-	glfwSetCursorPosCallback(window, cursorPosCallback);
 	glfwSetFramebufferSizeCallback(window, fbSizeCallback);
 	glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+	traceStartup("window", t0, glfwGetTime());
+
+	// The image is decoded while the rest comes up.
+	if (argc > 1) {
+		glfwSetWindowTitle(window, argv[1]);
+		loadStart(&load, argv[1]);
+	}
 
 	session             = malloc(sizeof(*session));
 	session->sprite     = NULL;
@@ -902,48 +4475,154 @@ int main(int argc, char *argv[])
 	session->offy       = 0;
 	session->zoom       = 1;
 	session->paused     = true;
+	session->vsync      = false;
+	session->fence      = false;
+	session->latency    = false;
+	session->pick       = point(-1, -1);
+	session->readback   = NULL;
+	session->selection  = NULL;
+	session->tiling     = 0;
+	session->tiled      = 0;
+	session->tiledSlot  = -1;
+	session->tile       = NULL;
+	session->symmetry   = SYMMETRY_NONE;
+	session->folds      = SYMMETRY_FOLDS;
 	session->fg         = WHITE;
 	session->bg         = WHITE;
 	session->started    = glfwGetTime();
 	session->fps        = 6;
+	session->grid       = 0;
 	session->filepath   = NULL;
+	session->journal    = NULL;
+	session->spill      = NULL;
+	session->history    = NULL;
 
-	if (argc > 1) {
-		glfwSetWindowTitle(window, argv[1]);
+	// Scripts drive px through a socket, or standard input if PX_SOCKET is "-".
+	char *spath = getenv("PX_SOCKET");
 
-		if (!loadSprites(argv[1])) {
-			createBlank();
-		}
-	} else {
-		createFilename(&session->filepath);
-		createBlank();
-	}
-	reset();
+	if (spath && !(server = cmdListen(spath)))
+		debug("error: couldn't listen on '%s': %s", spath, strerror(errno));
 
-	// Create first snapshot for undos.
-	spriteSnapshot(session->sprite);
+	// Undo states are paged out to disk past PX_MEMORY megabytes.
+	char *budget = getenv("PX_MEMORY");
+
+	session->budget = (size_t)(budget ? strtoul(budget, NULL, 10) : MEMORY_BUDGET) << 20;
 
 	// Color palette
+	t0 = glfwGetTime();
 	palette = malloc(sizeof(*palette));
 	palette->pixels = NULL;
 	palette->texture = 0;
+	palette->colors = NULL;
+	palette->nearest = NULL;
 	palette->fb = fbGen();
 
+	struct rgba *colors = NULL;
+	int ncolors = 0;
+
+	if (argc > 2 && !(colors = paletteLoad(argv[2], &ncolors)))
+		debug("error: couldn't load palette '%s': %s", argv[2], strerror(errno));
+
+	if (!colors) {
+		ncolors = 32;
+		colors = malloc(ncolors * sizeof(*colors));
+
+		for (int i = 0; i < ncolors; i++) {
+			colors[i] = hsla2rgba((struct hsla){i * 1.0f/(float)ncolors, 0.5, 0.5, 1.0});
+		}
+	}
+	paletteSet(colors, ncolors);
+	traceStartup("palette", t0, glfwGetTime());
+
 	// Glyphs
+	t0 = glfwGetTime();
 	glyphsInit();
+	overlayInit();
+	adjustInit();
+	traceStartup("glyphs and shaders", t0, glfwGetTime());
 
 	fbClear();
 	setupPalette();
 	setFgColor(WHITE);
+
+	// The window shows up right away, and stays responsive while the image
+	// is decoded.
+	if (argc > 1) {
+		char text[64];
+
+		snprintf(text, sizeof(text), "loading %s", argv[1]);
+
+		while (!loadDone(&load) && !glfwWindowShouldClose(window)) {
+			drawLoading(window, text);
+#if GLFW_VERSION_MAJOR > 3 || GLFW_VERSION_MINOR >= 2
+			glfwWaitEventsTimeout(LOAD_POLL);
+#else
+			glfwPollEvents();
+#endif
+		}
+		loadWait(&load);
+
+		// The window was closed before there was a sheet to show.
+		if (glfwWindowShouldClose(window)) {
+			glfwDestroyWindow(window);
+			glfwTerminate();
+			cmdClose(server);
+			exit(0);
+		}
+		if (load.decoded) {
+			traceStartup("image decode", load.started, load.decoded);
+			traceStartup("journal replay", load.decoded, load.finished);
+		}
+		t0 = glfwGetTime();
+
+		if (!loadSprites(&load)) {
+			createBlank();
+		}
+		traceStartup("layers", t0, glfwGetTime());
+	} else {
+		createFilename(&session->filepath);
+		createBlank();
+	}
+	reset();
+
+	char *jpath = sidecarPath(session->filepath, ".journal");
+	session->journal = journalOpen(jpath);
+	free(jpath);
+
 	brush(window, NULL);
 
+	// Input goes to the sheet once there is one.
+	glfwSetKeyCallback(window, keyCallback);
+	glfwSetMouseButtonCallback(window, mouseButtonCallback);
+	glfwSetCursorPosCallback(window, cursorPosCallback);
+
 	while (!glfwWindowShouldClose(window)) {
 		double mx, my;
 		int    w, h;
-		char   info[64];
+		char   info[128];
+		int    n;
+
+		// Commands wait for the first snapshot, so that they can be undone.
+		if (server && session->sprite->snapshot >= 0 && cmdPoll(server, COMMAND_BUDGET, command, window) > 0) {
+			enum tool t = session->tool.curr;
+			enum dstate d = session->tool.u.brush.drawing;
+
+			// A stroke in progress takes the changes with it when it ends.
+			if ((t != TOOL_BRUSH && t != TOOL_MULTI) || (d != DRAW_STARTED && d != DRAW_DRAWING))
+				spriteCommit(session->sprite);
+		}
+		pollSample();
 
 		struct sprite *s = session->sprite;
 		int zoom = session->zoom;
+		enum tool t = session->tool.curr;
+		enum dstate d = session->tool.u.brush.drawing;
+
+		// Pixels painted and erased again are released between strokes.
+		if ((t != TOOL_BRUSH && t != TOOL_MULTI) || (d != DRAW_STARTED && d != DRAW_DRAWING)) {
+			spriteCompact(s);
+			historyTrim();
+		}
 
 		glfwGetFramebufferSize(window, &w, &h);
 		glfwGetCursorPos(window, &mx, &my);
@@ -962,9 +4641,11 @@ int main(int argc, char *argv[])
 		glDisable(GL_DEPTH_TEST);
 
 		glPushMatrix(); {
-			glBindFramebuffer(GL_FRAMEBUFFER, s->fb);
 			spriteRender(s);
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			spriteWarm(s);
+
+			// The frame now reflects all input received.
+			latencyRendered();
 
 			glClear(GL_COLOR_BUFFER_BIT);
 			glClearColor(0.0, 0.0, 0.0, 0.0);
@@ -975,8 +4656,23 @@ int main(int argc, char *argv[])
 			glTranslatef(session->x, session->y, 0.0f);
 			glScalef(zoom, zoom, 1.0f);
 
+			if (zoom == 1)
+				drawOverlay(s);
+
+			bool adjusted = adjustBegin(s);
+
 			glColor4f(1.0, 1.0, 1.0, 1.0);
-			textureDraw(s->texture, 0, 0);
+			spriteDrawVisible(s);
+
+			if (adjusted)
+				adjustEnd();
+			drawTiling(s);
+
+			if (zoom > 1)
+				drawOverlay(s);
+
+			drawSelection(s);
+			drawShape(s);
 
 			if (onionMode) {
 				int frame = (mx - session->x) / s->fw / zoom;
@@ -987,38 +4683,102 @@ int main(int argc, char *argv[])
 				glPopMatrix();
 			}
 			if (s->nframes > 1 && !session->paused) {
+				bool adjusted = adjustBegin(s);
+
 				glTranslatef(-s->fw - 0.5, 0, 0.0f);
 				spriteRenderCurrentFrame(s);
+
+				if (adjusted)
+					adjustEnd();
 			}
 		}
 		glPopMatrix();
 
 		glColor4f(1.0, 1.0, 1.0, 1.0);
 		textureDraw(palette->texture, 0, 0);
+		sample();
 		drawCursor(window, floor(mx), floor(my), session->tool.curr);
 
-		sprintf(info, "%dx%dx%d", s->fw, s->fh, s->nframes);
+		struct layer *l = &s->layers[s->layer];
+
+		n = snprintf(info, sizeof(info), "%dx%dx%d  L%d/%d %s %d%%%s", s->fw, s->fh, s->nframes,
+			s->layer + 1, s->nlayers, blendNames[l->blend], l->opacity * 100 / 255, l->visible ? "" : " hidden");
+		if (adjust.on && n < (int)sizeof(info)) {
+			struct adjustment *a = &adjust.params;
+
+			snprintf(info + n, sizeof(info) - n, "  preview H%d S%+d L%+d %d-%d P%+d",
+				a->hue, a->saturation, a->lightness, a->low, a->high, a->shift);
+		}
 		drawGlyphs(info, session->x, session->y + s->fh * zoom + 5);
 
-		sprintf(info, "%dHz  %d%%", session->fps, session->zoom * 100);
+		n = snprintf(info, sizeof(info), "%dHz  %d%%", session->fps, session->zoom * 100);
+
+		if (session->symmetry == SYMMETRY_RADIAL)
+			snprintf(info + n, sizeof(info) - n, "  %s%d", symmetryNames[session->symmetry], session->folds);
+		else if (session->symmetry)
+			snprintf(info + n, sizeof(info) - n, "  %s", symmetryNames[session->symmetry]);
 		drawGlyphs(info, session->w - strlen(info) * GW, session->h - GH);
 
+		if (session->latency)
+			drawLatency();
+
 		glDisable(GL_BLEND);
 		glDisable(GL_TEXTURE_2D);
 		glFlush();
 		glfwSwapBuffers(window);
 
+		if (session->fence)
+			glFinish();
+
+		latencyPresented(glfwGetTime());
+
+		// The sheet is on screen: take the first snapshot for undos, and
+		// pick up the history of the sheet from there, before any input.
+		if (s->snapshot < 0) {
+			traceStartup("first frame of the sheet", 0, glfwGetTime());
+
+			double t0 = glfwGetTime();
+			spriteSnapshot(s);
+			spriteResume(s);
+			traceStartup("undo history", t0, glfwGetTime());
+			printStartup();
+		}
+
 		if (glfwGetWindowAttrib(window, GLFW_FOCUSED)) {
 			glfwPollEvents();
+		} else if (server) {
+			// Keep running commands in the background.
+#if GLFW_VERSION_MAJOR > 3 || GLFW_VERSION_MINOR >= 2
+			glfwWaitEventsTimeout(COMMAND_BUDGET);
+#else
+			glfwPollEvents();
+#endif
 		} else {
 			glfwWaitEvents();
 		}
 	}
-	glDeleteFramebuffers(1, &session->sprite->fb);
+	readbackDelete(session->readback);
+	maskFree(session->selection);
+	if (session->tile)
+		textureDelete(session->tile);
+	textureStreamDelete();
+	free(stamps.path);
+	free(stamps.copies);
+	free(stamps.rects);
+	free(stamps.spans);
+	free(stamps.rows);
 	glfwDestroyWindow(window);
 	glfwTerminate();
 
+	journalClose(session->journal);
+	spillClose(session->spill);
+	historyClose(session->history);
+	cmdClose(server);
+	printLatency();
+
 	free(palette->pixels);
+	free(palette->colors);
+	nearestFree(palette->nearest);
 	free(session);
 	free(palette);
 
@@ -7,6 +7,9 @@ struct palette {
 	int            h;
 	int            size;
 	uint8_t        *pixels;
+	struct rgba    *colors;
+	int            ncolors;
+	struct nearest *nearest; // Search structure for `colors`
 };
 
 struct point {
@@ -14,6 +17,15 @@ struct point {
 	int y;
 };
 
+struct rect {
+	int x0, y0; // Top-left corner
+	int x1, y1; // Bottom-right corner, exclusive
+};
+
+struct span {
+	int x0, x1; // Exclusive
+};
+
 enum dstate {
 	DRAW_STARTED = 1,
 	DRAW_DRAWING = 2,
@@ -30,30 +42,78 @@ enum mstate {
 struct marquee {
 	struct point min, max;
 	enum mstate  state;
+	enum maskop  op; // How the rectangle combines with the selection
+};
+
+enum symmetry {
+	SYMMETRY_NONE,
+	SYMMETRY_HORIZONTAL, // Left and right halves of frames mirror each other
+	SYMMETRY_VERTICAL,   // Top and bottom halves do
+	SYMMETRY_FOUR,       // Both
+	SYMMETRY_RADIAL      // Copies are rotated around the frame center
+};
+
+enum shapekind {
+	SHAPE_LINE,
+	SHAPE_RECT,
+	SHAPE_ELLIPSE
+};
+
+struct shape {
+	enum shapekind kind;
+	bool           fill;
+	bool           dragging;
+	struct point   from, to; // Ends or corners, inclusive, in sheet pixels
 };
 
 struct brush {
 	int          size;
 	enum dstate  drawing;
 	struct rgba  color;
+	enum blend   blend;
 	struct point curr;
 	struct point prev;
 };
 
+struct layer {
+	struct page **pages; // One page of pixels per frame slot, NULL if blank
+	int         opacity;
+	bool        visible;
+	enum blend  blend;
+};
+
 struct snapshot {
-	struct rgba *pixels;
+	struct tile  **tiles;
+	int          ntiles;
+	struct layer *layers; // Layer settings, without pixels
+	int          nlayers;
+	int          fw, fh;
 	int x, y;
 	int w, h;
+	long         spilled; // Where the tiles are in the spill file, or -1; `tiles` is NULL while paged out
+	long         saved;   // Where the state is in the history file, or -1
 };
 
 struct sprite {
-	struct texture  *texture;
-	GLuint          fb;
-	uint8_t         *pixels;
+	struct texture  **tiles;  // Composite of the layers per slot, in squares of RENDER_TILE, NULL where transparent
+	int             tcols;    // Squares across a frame
+	int             trows;    // Squares down a frame
 	bool            dirty;
 	int             fw;
 	int             fh;
 	int             nframes;
+	int             capacity;
+	int             *frames;
+	int             sweep;    // Next slot for the background pass to compact
+	struct layer    *layers;
+	int             nlayers;
+	int             layer;    // Layer being painted on
+	struct page     **below;  // Composite of the layers under `layer`, per slot
+	struct rect     damage;   // Part of the composite that is out of date
+	uint8_t         *cold;    // Squares of `tiles` not composited since loading, or NULL once none are
+	int             warm;     // Next square for the background pass to composite
+	struct rect     changed;  // Part of `layer` painted on since the last snapshot
+	bool            stale;    // Other layers changed within `changed` too
 	void            *image;
 	int             snapshot;
 	struct snapshot *snapshots;
@@ -64,7 +124,9 @@ enum tool {
 	TOOL_BRUSH,
 	TOOL_SAMPLER,
 	TOOL_MARQUEE,
-	TOOL_MULTI
+	TOOL_MULTI,
+	TOOL_WAND,
+	TOOL_SHAPE
 };
 
 struct session {
@@ -77,23 +139,66 @@ struct session {
 	int           zoom;
 	int           nsprites;
 	int           fps;
+	int           grid;
 	bool          paused;
+	bool          vsync;
+	bool          fence;   // Wait for the GPU to finish after each swap
+	bool          latency; // Show the latency histogram
+	struct point  pick;    // Where to sample a color on the next frame, if not -1
+	struct readback *readback; // Color sample in flight
 	double        started;
 	char          *filepath;
+	struct journal *journal;
+	struct spill  *spill;  // Undo states paged out of memory
+	struct history *history; // Undo states kept across sessions
+	size_t        budget;  // Bytes to use before paging undo states out, or 0 for no limit
 	struct sprite *sprites;
 	struct sprite *sprite;
 	struct rgba   fg;
 	struct rgba   bg;
+	struct mask   *selection; // Selected sheet pixels, or NULL if none are
+	int           tiling;    // Copies of the tiled frame across and down, or 0
+	int           tiled;     // Frame that is tiled
+	int           tiledSlot; // Slot composited in `tile`
+	struct texture *tile;    // Composite of the tiled frame, drawn repeated
+	enum symmetry symmetry;  // How brush stamps are copied within frames
+	int           folds;     // Copies around the center with SYMMETRY_RADIAL
 
 	struct {
 		enum tool curr;
 		union {
 			struct brush   brush;
 			struct marquee marquee;
+			struct shape   shape;
 		} u;
 	} tool;
 };
 
+// Bytes of memory used by each part of px
+struct memstats {
+	size_t canvas;   // Layer pages and cached stacks
+	size_t textures; // Composites and overlays on the GPU
+	size_t history;  // Undo states held in memory
+	size_t spilled;  // Undo states paged out to disk, not counted against the budget
+	size_t palette;
+};
+
+// Image decoded in the background at startup
+struct load {
+	char            *path;
+	void            *image;
+	struct rgba     *pixels;
+	int             w, h;
+	int             fw, fh;
+	int             replayed; // Edits recovered from the journal
+	int             error;    // Why the image couldn't be decoded, or 0
+	double          started, decoded, finished;
+	bool            done;
+	bool            sync;     // Decoded without a thread
+	pthread_mutex_t lock;
+	pthread_t       thread;
+};
+
 union arg {
 	bool         b;
 	int          i;
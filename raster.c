@@ -0,0 +1,154 @@
+//
+// raster.c
+// shape rasterization
+//
+// Shapes are rasterized with integer midpoint algorithms into horizontal
+// spans `y, x0, x1`, with `x1` exclusive, which are passed to a callback.
+// Corners are given inclusively, in any order. A shape never covers a pixel
+// twice, so spans can be blended as they come, and outlines are one pixel
+// thick, with no doubled pixels where they turn a corner.
+//
+#include <inttypes.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "raster.h"
+
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+#define SWAP(a, b) do { int _t = (a); (a) = (b); (b) = _t; } while (0)
+
+//
+// Bresenham's line, with the pixels of each row joined into one span.
+//
+void rasterLine(int x0, int y0, int x1, int y1, rasterspan fn, void *ctx)
+{
+	int dx  = abs(x1 - x0), sx = x0 < x1 ? 1 : -1,
+	    dy  = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1,
+	    err = dx + dy,
+	    run = x0; // Where the span of the current row starts
+
+	while (x0 != x1 || y0 != y1) {
+		int e2 = 2 * err, x = x0;
+
+		if (e2 >= dy) {
+			err += dy;
+			x0  += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			fn(y0, min(run, x), max(run, x) + 1, ctx);
+			y0  += sy;
+			run  = x0;
+		}
+	}
+	fn(y0, min(run, x0), max(run, x0) + 1, ctx);
+}
+
+void rasterRect(int x0, int y0, int x1, int y1, bool fill, rasterspan fn, void *ctx)
+{
+	if (x0 > x1)
+		SWAP(x0, x1);
+	if (y0 > y1)
+		SWAP(y0, y1);
+
+	for (int y = y0; y <= y1; y++) {
+		if (fill || y == y0 || y == y1 || x1 - x0 < 2) {
+			fn(y, x0, x1 + 1, ctx);
+		} else {
+			fn(y, x0, x0 + 1, ctx);
+			fn(y, x1, x1 + 1, ctx);
+		}
+	}
+}
+
+//
+// Extend the span of row `i` of `lo, hi` to cover `x`.
+//
+static inline void extend(int *lo, int *hi, int n, int i, int x)
+{
+	if (i < 0 || i >= n)
+		return;
+
+	lo[i] = min(lo[i], x);
+	hi[i] = max(hi[i], x);
+}
+
+//
+// The midpoint ellipse inscribed in the rectangle, after Alois Zingl's
+// "A Rasterizing Algorithm for Drawing Curves", which handles even sizes
+// by splitting the center. The right half is traced first, giving the
+// outline's run of pixels on each row, and the left half is its mirror.
+//
+void rasterEllipse(int x0, int y0, int x1, int y1, bool fill, rasterspan fn, void *ctx)
+{
+	if (x0 > x1)
+		SWAP(x0, x1);
+	if (y0 > y1)
+		SWAP(y0, y1);
+
+	int64_t a   = x1 - x0,
+	        b   = y1 - y0,
+	        b1  = b & 1,
+	        dx  = 4 * (1 - a) * b * b,
+	        dy  = 4 * (b1 + 1) * a * a,
+	        err = dx + dy + b1 * a * a;
+
+	int n      = b + 1,
+	    mirror = x0 + x1, // Sum of the two sides of each row
+	    r      = x1,
+	    l      = x0,
+	    lower  = (b + 1) / 2, // Rows, from the top
+	    upper  = lower - b1;
+	int *lo = malloc(n * sizeof(*lo)),
+	    *hi = malloc(n * sizeof(*hi));
+
+	for (int i = 0; i < n; i++) {
+		lo[i] = INT_MAX;
+		hi[i] = INT_MIN;
+	}
+	a  *= 8 * a;
+	b1  = 8 * b * b;
+
+	do {
+		extend(lo, hi, n, lower, r);
+		extend(lo, hi, n, upper, r);
+
+		int64_t e2 = 2 * err;
+
+		if (e2 <= dy) {
+			lower++;
+			upper--;
+			err += dy += a;
+		}
+		if (e2 >= dx || 2 * err > dy) {
+			l++;
+			r--;
+			err += dx += b1;
+		}
+	} while (l <= r);
+
+	// Very flat ellipses stop short of their ends.
+	while (lower - upper <= b) {
+		extend(lo, hi, n, lower++, r + 1);
+		extend(lo, hi, n, upper--, r + 1);
+	}
+
+	for (int i = 0; i < n; i++) {
+		if (hi[i] < lo[i])
+			continue;
+
+		int outer = hi[i], inner = lo[i];
+
+		if (fill || mirror - inner + 1 >= inner) {
+			fn(y0 + i, mirror - outer, outer + 1, ctx);
+		} else {
+			fn(y0 + i, mirror - outer, mirror - inner + 1, ctx);
+			fn(y0 + i, inner, outer + 1, ctx);
+		}
+	}
+	free(lo);
+	free(hi);
+}
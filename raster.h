@@ -0,0 +1,9 @@
+//
+// raster.h
+// shape rasterization
+//
+typedef void (*rasterspan)(int, int, int, void *);
+
+void rasterLine(int, int, int, int, rasterspan, void *);
+void rasterRect(int, int, int, int, bool, rasterspan, void *);
+void rasterEllipse(int, int, int, int, bool, rasterspan, void *);
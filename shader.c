@@ -0,0 +1,72 @@
+//
+// shader.c
+// shader compilation
+//
+#define GL_GLEXT_PROTOTYPES
+
+#ifdef __APPLE__
+#include <OpenGL/gl.h>
+#else
+#include <GL/gl.h>
+#endif
+
+#include <stdio.h>
+
+#include "shader.h"
+
+static GLuint shaderCompile(GLenum type, const char *src)
+{
+	GLuint id = glCreateShader(type);
+	GLint  ok;
+
+	glShaderSource(id, 1, &src, NULL);
+	glCompileShader(id);
+	glGetShaderiv(id, GL_COMPILE_STATUS, &ok);
+
+	if (!ok) {
+		char log[512];
+
+		glGetShaderInfoLog(id, sizeof(log), NULL, log);
+		fprintf(stderr, "shader: %s\n", log);
+		glDeleteShader(id);
+
+		return 0;
+	}
+	return id;
+}
+
+//
+// Compile and link a program from vertex and fragment shader sources.
+// Returns 0 on failure, after logging the reason.
+//
+GLuint shaderProgram(const char *vsrc, const char *fsrc)
+{
+	GLuint vs = shaderCompile(GL_VERTEX_SHADER, vsrc),
+	       fs = shaderCompile(GL_FRAGMENT_SHADER, fsrc),
+	       id = 0;
+	GLint  ok;
+
+	if (vs && fs) {
+		id = glCreateProgram();
+
+		glAttachShader(id, vs);
+		glAttachShader(id, fs);
+		glLinkProgram(id);
+		glGetProgramiv(id, GL_LINK_STATUS, &ok);
+
+		if (!ok) {
+			char log[512];
+
+			glGetProgramInfoLog(id, sizeof(log), NULL, log);
+			fprintf(stderr, "shader: %s\n", log);
+			glDeleteProgram(id);
+
+			id = 0;
+		}
+	}
+	// Shaders are kept alive by the program they are attached to.
+	if (vs) glDeleteShader(vs);
+	if (fs) glDeleteShader(fs);
+
+	return id;
+}
@@ -0,0 +1,4 @@
+//
+// shader.h
+//
+GLuint shaderProgram(const char *, const char *);
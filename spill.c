@@ -0,0 +1,116 @@
+//
+// spill.c
+// compressed overflow storage
+//
+// Data that is rarely needed, like old undo states, can be compressed and
+// appended to an anonymous temporary file, then read back from the offset
+// it was written at. The system removes the file once it is closed or px
+// exits. The space of dropped blocks isn't reused.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "deflate.h"
+#include "spill.h"
+
+#define SPILL_LEVEL 1 // Blocks are written while editing, so favour speed
+
+struct block {
+	uint64_t size;    // Original size
+	uint64_t encoded; // Size of the zlib stream that follows
+};
+
+struct spill *spillOpen(void)
+{
+	FILE *fp = tmpfile();
+
+	if (!fp)
+		return NULL;
+
+	struct spill *sp = malloc(sizeof(*sp));
+
+	sp->fp    = fp;
+	sp->size  = 0;
+	sp->bytes = 0;
+
+	return sp;
+}
+
+//
+// Compress and append the `n` bytes at `data`. Returns the offset to read
+// them back from, or -1 on error.
+//
+long spillWrite(struct spill *sp, const uint8_t *data, size_t n)
+{
+	struct block b = { .size = n };
+	size_t encoded;
+	uint8_t *z = deflateEncode(data, n, SPILL_LEVEL, &encoded);
+	long offset = sp->size;
+
+	if (!z)
+		return -1;
+
+	b.encoded = encoded;
+
+	bool ok = fseek(sp->fp, offset, SEEK_SET) == 0 &&
+	          fwrite(&b, sizeof(b), 1, sp->fp) == 1 &&
+	          fwrite(z, 1, encoded, sp->fp) == encoded &&
+	          fflush(sp->fp) == 0;
+
+	free(z);
+
+	if (!ok)
+		return -1;
+
+	sp->size  += sizeof(b) + encoded;
+	sp->bytes += sizeof(b) + encoded;
+
+	return offset;
+}
+
+//
+// Read back the block written at `offset`, setting `*n` to its size.
+// Returns NULL on error.
+//
+uint8_t *spillRead(struct spill *sp, long offset, size_t *n)
+{
+	struct block b;
+
+	if (fseek(sp->fp, offset, SEEK_SET) || fread(&b, sizeof(b), 1, sp->fp) != 1 ||
+	    b.encoded > (uint64_t)(sp->size - offset))
+		return NULL;
+
+	uint8_t *z = malloc(b.encoded), *data = malloc(b.size ? b.size : 1);
+
+	if (fread(z, 1, b.encoded, sp->fp) != b.encoded || deflateDecode(z, b.encoded, data, b.size)) {
+		free(z);
+		free(data);
+		return NULL;
+	}
+	free(z);
+	*n = b.size;
+
+	return data;
+}
+
+//
+// Mark the block at `offset` as no longer needed.
+//
+void spillDrop(struct spill *sp, long offset)
+{
+	struct block b;
+
+	if (fseek(sp->fp, offset, SEEK_SET) == 0 && fread(&b, sizeof(b), 1, sp->fp) == 1)
+		sp->bytes -= sizeof(b) + b.encoded;
+}
+
+void spillClose(struct spill *sp)
+{
+	if (!sp)
+		return;
+
+	fclose(sp->fp);
+	free(sp);
+}
@@ -0,0 +1,15 @@
+//
+// spill.h
+// compressed overflow storage
+//
+struct spill {
+	FILE *fp;
+	long size;  // Bytes written to the file
+	long bytes; // Bytes of the blocks still in use
+};
+
+struct spill *spillOpen(void);
+long          spillWrite(struct spill *, const uint8_t *, size_t);
+uint8_t      *spillRead(struct spill *, long, size_t *);
+void          spillDrop(struct spill *, long);
+void          spillClose(struct spill *);
@@ -10,10 +10,73 @@
 #include <GL/gl.h>
 #endif
 
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "texture.h"
 
+//
+// Uploads go through a ring of pixel buffer objects: the data is written
+// into mapped buffer memory, and the texture is updated from the buffer,
+// which the driver can do after the call returns. A fence tells when the GPU
+// is done with a buffer; if it isn't by the time the ring comes back around,
+// the buffer is orphaned, so the driver hands out new memory instead of
+// waiting.
+//
+#define STREAM_BUFFERS 4
+
+// Fences need OpenGL 3.2, or ARB_sync.
+#ifdef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define HAVE_SYNC
+#endif
+
+struct readback {
+	GLuint buffer;
+	int    w, h;
+	bool   pending;
+#ifdef HAVE_SYNC
+	GLsync fence;
+#endif
+};
+
+static struct {
+	GLuint  buffers[STREAM_BUFFERS];
+	size_t  sizes[STREAM_BUFFERS];
+#ifdef HAVE_SYNC
+	GLsync  fences[STREAM_BUFFERS];
+#endif
+	int     next;
+	bool    mapped;  // Whether `textureMap` returned buffer memory
+	uint8_t *client; // Or this, if the buffer couldn't be mapped
+	size_t  cap;
+} stream;
+
+#ifdef HAVE_SYNC
+static bool fenceDone(GLsync *fence)
+{
+	if (!*fence)
+		return true;
+
+	GLenum r = glClientWaitSync(*fence, 0, 0);
+
+	if (r == GL_TIMEOUT_EXPIRED)
+		return false;
+
+	glDeleteSync(*fence);
+	*fence = 0;
+
+	return true;
+}
+
+static void fenceSet(GLsync *fence)
+{
+	if (*fence)
+		glDeleteSync(*fence);
+	*fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+#endif
+
 void textureDraw(struct texture *t, float sx, float sy)
 {
 	textureDrawRect(t, 0, 0, t->w, t->h, sx, sy);
@@ -79,6 +142,12 @@ struct texture *textureGen(int w, int h, uint8_t *data)
 	return t;
 }
 
+void textureDelete(struct texture *t)
+{
+	glDeleteTextures(1, &t->id);
+	free(t);
+}
+
 GLuint fbGen()
 {
 	GLuint id;
@@ -87,10 +156,160 @@ GLuint fbGen()
 	return id;
 }
 
-void textureRefresh(GLuint id, int w, int h, uint8_t *data)
+//
+// Return `size` bytes of memory to write pixels to, for `textureUnmap` to
+// upload. Only one region can be mapped at a time.
+//
+uint8_t *textureMap(size_t size)
+{
+	int i = stream.next;
+
+	if (!stream.buffers[0])
+		glGenBuffers(STREAM_BUFFERS, stream.buffers);
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stream.buffers[i]);
+
+	bool busy = false;
+#ifdef HAVE_SYNC
+	busy = !fenceDone(&stream.fences[i]);
+#endif
+	if (busy || size > stream.sizes[i]) {
+		stream.sizes[i] = size > stream.sizes[i] ? size : stream.sizes[i];
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, stream.sizes[i], NULL, GL_STREAM_DRAW);
+	}
+	uint8_t *p = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+
+	if ((stream.mapped = p != NULL))
+		return p;
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	if (size > stream.cap) {
+		stream.cap    = size;
+		stream.client = realloc(stream.client, size);
+	}
+	return stream.client;
+}
+
+//
+// Upload the pixels written since `textureMap` to the `w * h` region of
+// texture `id` at `x, y`.
+//
+static void streamUpload(GLuint id, int x, int y, int w, int h)
 {
 	glBindTexture(GL_TEXTURE_2D, id);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, (GLsizei)w, (GLsizei)h, GL_RGBA, GL_UNSIGNED_BYTE, data);
+
+	if (stream.mapped) {
+		int i = stream.next;
+
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, (GLsizei)w, (GLsizei)h, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+#ifdef HAVE_SYNC
+		fenceSet(&stream.fences[i]);
+#endif
+		stream.next = (i + 1) % STREAM_BUFFERS;
+		stream.mapped = false;
+	} else {
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, (GLsizei)w, (GLsizei)h, GL_RGBA, GL_UNSIGNED_BYTE, stream.client);
+	}
 	glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void textureUnmap(struct texture *t, int x, int y, int w, int h)
+{
+	streamUpload(t->id, x, y, w, h);
+}
+
+void textureRefresh(GLuint id, int w, int h, uint8_t *data)
+{
+	memcpy(textureMap((size_t)w * h * 4), data, (size_t)w * h * 4);
+	streamUpload(id, 0, 0, w, h);
+}
+
+void textureUpdate(struct texture *t, int x, int y, int w, int h, uint8_t *data)
+{
+	memcpy(textureMap((size_t)w * h * 4), data, (size_t)w * h * 4);
+	streamUpload(t->id, x, y, w, h);
+}
+
+void textureStreamDelete(void)
+{
+	if (stream.buffers[0])
+		glDeleteBuffers(STREAM_BUFFERS, stream.buffers);
+#ifdef HAVE_SYNC
+	for (int i = 0; i < STREAM_BUFFERS; i++) {
+		if (stream.fences[i])
+			glDeleteSync(stream.fences[i]);
+	}
+#endif
+	free(stream.client);
+	memset(&stream, 0, sizeof(stream));
+}
+
+//
+// Start reading the `w * h` pixels at `x, y` of the bound read framebuffer
+// into a pixel buffer object. The read completes on the GPU's own time;
+// `readbackPoll` collects it, normally on a later frame.
+//
+struct readback *readbackStart(struct readback *r, int x, int y, int w, int h)
+{
+	if (!r) {
+		r = calloc(1, sizeof(*r));
+		glGenBuffers(1, &r->buffer);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, r->buffer);
+
+	if (w * h > r->w * r->h || r->pending)
+		glBufferData(GL_PIXEL_PACK_BUFFER, (size_t)w * h * 4, NULL, GL_STREAM_READ);
+
+	glReadPixels(x, y, (GLsizei)w, (GLsizei)h, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	r->w = w;
+	r->h = h;
+	r->pending = true;
+#ifdef HAVE_SYNC
+	fenceSet(&r->fence);
+#endif
+	return r;
+}
+
+//
+// Copy the pixels of the last read to `out`, if it has completed. Returns
+// false if there is nothing to collect yet.
+//
+bool readbackPoll(struct readback *r, uint8_t *out)
+{
+	if (!r || !r->pending)
+		return false;
+#ifdef HAVE_SYNC
+	if (!fenceDone(&r->fence))
+		return false;
+#endif
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, r->buffer);
+
+	uint8_t *p = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+
+	if (p) {
+		memcpy(out, p, (size_t)r->w * r->h * 4);
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	r->pending = false;
+
+	return p != NULL;
+}
+
+void readbackDelete(struct readback *r)
+{
+	if (!r)
+		return;
+
+	glDeleteBuffers(1, &r->buffer);
+#ifdef HAVE_SYNC
+	if (r->fence)
+		glDeleteSync(r->fence);
+#endif
+	free(r);
+}
@@ -8,8 +8,19 @@ struct texture {
 	uint8_t *data;
 };
 
+struct readback;
+
 struct texture *textureGen(int, int, uint8_t*);
 void            textureRefresh(unsigned int, int, int, uint8_t*);
+void            textureUpdate(struct texture *, int, int, int, int, uint8_t *);
+uint8_t        *textureMap(size_t);
+void            textureUnmap(struct texture *, int, int, int, int);
+void            textureStreamDelete(void);
 void            textureDraw(struct texture *, float, float);
 void            textureDrawRect(struct texture *, int, int, int, int, float, float);
+void            textureDelete(struct texture *);
 GLuint          fbGen();
+
+struct readback *readbackStart(struct readback *, int, int, int, int);
+bool             readbackPoll(struct readback *, uint8_t *);
+void             readbackDelete(struct readback *);
@@ -4,23 +4,28 @@
  * tga.c
  *
  */
+#include <errno.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "tga.h"
 
+#define TGA_TRUECOLOR     2
+#define TGA_TRUECOLOR_RLE 10
+
 struct pixel {
 	unsigned char r, g, b, a;
 };
 
-struct tga *tgaDecode(const char *path)
+/*
+ * Read a 24 or 32-bit true-color image, uncompressed or run-length encoded.
+ * Returns NULL with `errno` set to EINVAL if the image is invalid or isn't
+ * one of those.
+ */
+struct tga *tgaRead(FILE *fp)
 {
-	FILE *fp = fopen(path, "rb");
-
-	if (!fp)
-		return NULL;
-
 	struct tga *t = malloc(sizeof(*t));
 
 	fread(&t->header.idlen, 1, 1, fp);
@@ -36,36 +41,102 @@ struct tga *tgaDecode(const char *path)
 	fread(&t->depth, 1, 1, fp);
 	fread(&t->header.imagedesc, 1, 1, fp);
 
+	size_t idlen = (unsigned char)t->header.idlen;
+
+	t->id[fread(t->id, 1, idlen, fp)] = '\0';
+	t->data = NULL;
+
+	if (feof(fp) || t->width <= 0 || t->height <= 0 || (t->depth != 24 && t->depth != 32) ||
+	    (t->header.imagetype != TGA_TRUECOLOR && t->header.imagetype != TGA_TRUECOLOR_RLE))
+		goto invalid;
+
+	// True-color images may still come with a color map, which is skipped.
+	if (t->header.colormaptype)
+		fseek(fp, (unsigned short)t->header.colormaplen * (((unsigned char)t->header.colormapdepth + 7) / 8), SEEK_CUR);
+
 	t->data = malloc(sizeof(struct pixel) * t->width * t->height);
 
-	int bytes = t->depth / 8;
-	char p[4];
+	int bytes = t->depth / 8, n = t->width * t->height;
+	unsigned char p[4];
+
+	for (int i = 0; i < n;) {
+		int count = 1, run = 1;
 
-	for (int i = 0; i < t->width * t->height; i++) {
-		p[3] = 0xff; // Default to 100% opaque
+		if (t->header.imagetype == TGA_TRUECOLOR_RLE) {
+			int c = fgetc(fp);
 
-		if (!fread(p, bytes, 1, fp)) {
-			fprintf(stderr, "error: unexpected EOF at offset %d\n", i);
-			exit(-1);
+			if (c == EOF)
+				goto invalid;
+
+			count = (c & 0x7f) + 1;
+			run   = c & 0x80;
+
+			if (count > n - i)
+				goto invalid;
+		}
+		for (int j = 0; j < count; j++, i++) {
+			if (j == 0 || !run) {
+				p[3] = 0xff; // Default to 100% opaque
+
+				if (!fread(p, bytes, 1, fp))
+					goto invalid;
+			}
+			*(struct pixel *)&t->data[i] = (struct pixel){p[2], p[1], p[0], p[3]};
 		}
-		*(struct pixel *)&t->data[i] = (struct pixel){p[2], p[1], p[0], p[3]};
 	}
 	return t;
-}
 
+invalid:
+	free(t->data);
+	free(t);
+	errno = EINVAL;
 
-int tgaEncode(uint32_t *pixels, short w, short h, char depth, const char *path)
+	return NULL;
+}
+
+struct tga *tgaDecode(const char *path)
 {
-	FILE *fp = fopen(path, "wb");
+	FILE *fp = fopen(path, "rb");
 
 	if (!fp)
-		return 1;
+		return NULL;
+
+	struct tga *t = tgaRead(fp);
+
+	fclose(fp);
+
+	return t;
+}
+
+/*
+ * Find how many pixels from `i` are the same as pixel `i`, up to `max`.
+ */
+static int runLength(const uint32_t *pixels, int i, int n, int max)
+{
+	int len = 1;
+
+	while (len < max && i + len < n && pixels[i + len] == pixels[i])
+		len++;
 
+	return len;
+}
+
+
+/*
+ * Write `pixels` to `fp`, run-length encoded if `rle` is set. Returns
+ * non-zero on error.
+ */
+int tgaWrite(FILE *fp, uint32_t *pixels, short w, short h, char depth, const char *id, int rle)
+{
 	short null = 0x0;
+	size_t idlen = id ? strlen(id) : 0;
+
+	if (idlen > 255)
+		idlen = 255;
 
-	fputc(0, fp); // ID length
+	fputc(idlen, fp); // ID length
 	fputc(0, fp); // No color map
-	fputc(2, fp); // Uncompressed 32-bit RGBA
+	fputc(rle ? TGA_TRUECOLOR_RLE : TGA_TRUECOLOR, fp);
 
 	fwrite(&null, 2, 1, fp);  // Color map offset
 	fwrite(&null, 2, 1, fp);  // Color map length
@@ -76,21 +147,51 @@ int tgaEncode(uint32_t *pixels, short w, short h, char depth, const char *path)
 	fwrite(&h, 2, 1, fp);     // Height
 	fwrite(&depth, 1, 1, fp); // Depth
 	fwrite(&null, 1, 1, fp);  // Image descriptor
+	fwrite(id, 1, idlen, fp); // Image ID
 
-	int bytes = depth / 8;
-	char p[4];
+	int bytes = depth / 8, n = w * h;
+	unsigned char p[4];
 
-	for (int i = 0; i < w * h; i++) {
-		p[0] = ((struct pixel *)&pixels[i])->b;
-		p[1] = ((struct pixel *)&pixels[i])->g;
-		p[2] = ((struct pixel *)&pixels[i])->r;
-		p[3] = ((struct pixel *)&pixels[i])->a;
+	for (int i = 0; i < n;) {
+		int count = 1, run = 0;
 
-		if (!fwrite(p, bytes, 1, fp)) {
-			fprintf(stderr, "error: unexpected EOF at offset %d\n", i);
-			exit(-1);
+		// Packets hold up to 128 pixels: either one repeated, or a raw
+		// sequence that stops where a run starts.
+		if (rle) {
+			run = runLength(pixels, i, n, 128) > 1;
+
+			if (run)
+				count = runLength(pixels, i, n, 128);
+			else
+				while (count < 128 && i + count < n && runLength(pixels, i + count, n, 2) < 2)
+					count++;
+
+			fputc((run ? 0x80 : 0) | (count - 1), fp);
 		}
+		for (int j = 0; j < (run ? 1 : count); j++) {
+			const struct pixel *px = (struct pixel *)&pixels[i + j];
+
+			p[0] = px->b;
+			p[1] = px->g;
+			p[2] = px->r;
+			p[3] = px->a;
+
+			fwrite(p, bytes, 1, fp);
+		}
+		i += count;
 	}
-	return 0;
+	return ferror(fp) != 0;
+}
+
+int tgaEncode(uint32_t *pixels, short w, short h, char depth, const char *id, const char *path)
+{
+	FILE *fp = fopen(path, "wb");
+
+	if (!fp)
+		return 1;
+
+	int err = tgaWrite(fp, pixels, w, h, depth, id, 0);
+
+	return (fclose(fp) != 0) | err;
 }
 
@@ -21,7 +21,10 @@ struct tga {
 	short    height;
 	char     depth;
 	uint32_t *data;
+	char     id[256]; // Image ID, NUL-terminated
 };
 
 struct tga *tgaDecode(const char *path);
-int         tgaEncode(uint32_t *data, short w, short h, char depth, const char *path);
+struct tga *tgaRead(FILE *fp);
+int         tgaEncode(uint32_t *data, short w, short h, char depth, const char *id, const char *path);
+int         tgaWrite(FILE *fp, uint32_t *data, short w, short h, char depth, const char *id, int rle);
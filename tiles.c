@@ -0,0 +1,408 @@
+//
+// tiles.c
+// content-addressed tile store
+//
+// Images are split into TILE_SIZE² tiles, laid out cell by cell (a cell is
+// one frame of one layer) so that identical cells produce identical tiles.
+// Tiles are immutable and interned by content: storing the same pixels twice
+// only costs a reference.
+//
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "color.h"
+#include "tiles.h"
+
+#define TILE_PIXELS (TILE_SIZE * TILE_SIZE)
+
+static struct {
+	struct tile **buckets;
+	size_t      nbuckets;
+	size_t      unique;
+	size_t      refs;
+} store;
+
+static inline uint64_t mix(uint64_t h, uint64_t v)
+{
+	h = (h ^ v) * 0xff51afd7ed558ccdULL;
+	return h ^ (h >> 32);
+}
+
+//
+// Hash four interleaved lanes, so the multiplies don't form one long
+// dependency chain.
+//
+static uint64_t tileHash(const struct rgba *pixels)
+{
+	const unsigned char *p = (const unsigned char *)pixels;
+	uint64_t a = 0x9e3779b97f4a7c15ULL, b = 0xc2b2ae3d27d4eb4fULL,
+	         c = 0x165667b19e3779f9ULL, d = 0x27d4eb2f165667c5ULL;
+
+	for (size_t i = 0; i < TILE_PIXELS * sizeof(*pixels); i += 32) {
+		uint64_t w[4];
+		memcpy(w, p + i, sizeof(w));
+
+		a = mix(a, w[0]);
+		b = mix(b, w[1]);
+		c = mix(c, w[2]);
+		d = mix(d, w[3]);
+	}
+	return mix(mix(a, b), mix(c, d));
+}
+
+static void storeGrow(void)
+{
+	size_t n = store.nbuckets ? store.nbuckets * 2 : 1024;
+	struct tile **buckets = calloc(n, sizeof(*buckets));
+
+	for (size_t i = 0; i < store.nbuckets; i++) {
+		struct tile *t = store.buckets[i], *next;
+
+		for (; t; t = next) {
+			next = t->next;
+			t->next = buckets[t->hash & (n - 1)];
+			buckets[t->hash & (n - 1)] = t;
+		}
+	}
+	free(store.buckets);
+
+	store.buckets = buckets;
+	store.nbuckets = n;
+}
+
+//
+// Return the shared tile holding the `w * h` pixels at `src`, padded with
+// transparent pixels up to the tile size. The caller owns one reference.
+//
+struct tile *tileIntern(const struct rgba *src, int stride, int w, int h)
+{
+	struct rgba pixels[TILE_PIXELS];
+
+	if (w < TILE_SIZE || h < TILE_SIZE)
+		memset(pixels, 0, sizeof(pixels));
+
+	for (int y = 0; y < h; y++) {
+		memcpy(&pixels[y * TILE_SIZE], &src[y * stride], w * sizeof(*src));
+	}
+	if (store.unique >= store.nbuckets)
+		storeGrow();
+
+	uint64_t hash = tileHash(pixels);
+	struct tile **bucket = &store.buckets[hash & (store.nbuckets - 1)];
+
+	for (struct tile *t = *bucket; t; t = t->next) {
+		if (t->hash == hash && !memcmp(t->pixels, pixels, sizeof(pixels))) {
+			t->refs++;
+			store.refs++;
+			return t;
+		}
+	}
+	struct tile *t = malloc(sizeof(*t));
+
+	t->hash  = hash;
+	t->refs  = 1;
+	t->saved = 0;
+	t->next  = *bucket;
+	memcpy(t->pixels, pixels, sizeof(pixels));
+
+	*bucket = t;
+	store.unique++;
+	store.refs++;
+
+	return t;
+}
+
+//
+// Return the fully transparent tile. The caller owns one reference.
+//
+struct tile *tileBlank(void)
+{
+	static const struct rgba blank[TILE_PIXELS];
+
+	return tileIntern(blank, TILE_SIZE, TILE_SIZE, TILE_SIZE);
+}
+
+void tileRetain(struct tile *t)
+{
+	t->refs++;
+	store.refs++;
+}
+
+void tileRelease(struct tile *t)
+{
+	store.refs--;
+
+	if (--t->refs > 0)
+		return;
+
+	struct tile **p = &store.buckets[t->hash & (store.nbuckets - 1)];
+
+	while (*p != t)
+		p = &(*p)->next;
+
+	*p = t->next;
+	store.unique--;
+
+	free(t);
+}
+
+//
+// Renumber the tiles saved in the history file, after it was rewritten: the
+// tile numbered `i + 1` becomes `map[i]`, where 0 means it's no longer in
+// the file. Tiles numbered past `n`, or all of them if `n` is 0, are
+// forgotten.
+//
+void tilesRenumber(const uint32_t *map, uint32_t n)
+{
+	for (size_t i = 0; i < store.nbuckets; i++) {
+		for (struct tile *t = store.buckets[i]; t; t = t->next)
+			t->saved = t->saved && t->saved <= n ? map[t->saved - 1] : 0;
+	}
+}
+
+struct tilestats tileStats(void)
+{
+	return (struct tilestats){
+		.unique  = store.unique,
+		.refs    = store.refs,
+		.bytes   = store.unique * sizeof(struct tile) + store.nbuckets * sizeof(struct tile *),
+		.logical = store.refs * TILE_PIXELS * sizeof(struct rgba)
+	};
+}
+
+int tilesPerFrame(int fw, int fh)
+{
+	return ((fw + TILE_SIZE - 1) / TILE_SIZE) * ((fh + TILE_SIZE - 1) / TILE_SIZE);
+}
+
+//
+// Split a sheet of `w * h` pixels made of cells of `fw * fh` pixels into
+// tiles. Returns the tiles cell by cell, each cell row by row, with cells
+// in row-major order.
+//
+struct tile **tilesFromPixels(const struct rgba *pixels, int w, int h, int fw, int fh, int *n)
+{
+	int ncells = (w / fw) * (h / fh);
+	struct tile **tiles = malloc(ncells * tilesPerFrame(fw, fh) * sizeof(*tiles)), **t = tiles;
+
+	for (int cy = 0; cy + fh <= h; cy += fh) {
+		for (int cx = 0; cx + fw <= w; cx += fw) {
+			for (int y = 0; y < fh; y += TILE_SIZE) {
+				for (int x = 0; x < fw; x += TILE_SIZE) {
+					*t++ = tileIntern(&pixels[(cy + y) * w + cx + x], w,
+					                  fw - x < TILE_SIZE ? fw - x : TILE_SIZE,
+					                  fh - y < TILE_SIZE ? fh - y : TILE_SIZE);
+				}
+			}
+		}
+	}
+	*n = ncells * tilesPerFrame(fw, fh);
+
+	return tiles;
+}
+
+//
+// Copy the rectangle `rect` (x, y, w, h) of the sheet held by `tiles` to
+// `out`, which is `rect[2]` pixels wide.
+//
+void tilesReadRect(struct tile **tiles, int w, int h, int fw, int fh, const int *rect, struct rgba *out)
+{
+	int tx = (fw + TILE_SIZE - 1) / TILE_SIZE,
+	    per = tilesPerFrame(fw, fh),
+	    cols = w / fw;
+	int x1 = rect[0] + rect[2],
+	    y1 = rect[1] + rect[3];
+
+	for (int y = rect[1]; y < y1; y++) {
+		int cy = y / fh, ty = y % fh;
+
+		for (int x = rect[0]; x < x1;) {
+			int cx = x / fw, fx = x % fw,
+			    n = TILE_SIZE - fx % TILE_SIZE;
+
+			if (fx + n > fw)
+				n = fw - fx;
+			if (x + n > x1)
+				n = x1 - x;
+
+			struct tile *t = tiles[(cy * cols + cx) * per + (ty / TILE_SIZE) * tx + fx / TILE_SIZE];
+
+			memcpy(&out[(y - rect[1]) * rect[2] + x - rect[0]],
+			       &t->pixels[(ty % TILE_SIZE) * TILE_SIZE + fx % TILE_SIZE], n * sizeof(*out));
+			x += n;
+		}
+	}
+}
+
+void tilesToPixels(struct tile **tiles, struct rgba *pixels, int w, int h, int fw, int fh)
+{
+	tilesReadRect(tiles, w, h, fw, fh, (int[]){0, 0, w, h}, pixels);
+}
+
+void tilesRelease(struct tile **tiles, int n)
+{
+	for (int i = 0; i < n; i++) {
+		tileRelease(tiles[i]);
+	}
+	free(tiles);
+}
+
+//
+// Compute the bounding rectangle `{x, y, w, h}` of the tiles that differ
+// between two tile sets of the same sheet. Since tiles are interned, this
+// only compares pointers. Tile sets of different sizes differ everywhere.
+// Returns false if nothing changed.
+//
+bool tilesDiff(struct tile **a, int na, struct tile **b, int nb, int w, int h, int fw, int fh, int *rect)
+{
+	if (!a || na != nb) {
+		rect[0] = rect[1] = 0;
+		rect[2] = w;
+		rect[3] = h;
+		return true;
+	}
+	int tx = (fw + TILE_SIZE - 1) / TILE_SIZE,
+	    per = tilesPerFrame(fw, fh),
+	    cols = w / fw;
+	int x0 = w, y0 = h, x1 = 0, y1 = 0;
+
+	for (int i = 0; i < nb; i++) {
+		if (a[i] == b[i])
+			continue;
+
+		int c = i / per,
+		    cx = (c % cols) * fw,
+		    cy = (c / cols) * fh,
+		    x = cx + (i % per % tx) * TILE_SIZE,
+		    y = cy + (i % per / tx) * TILE_SIZE,
+		    xe = x + TILE_SIZE > cx + fw ? cx + fw : x + TILE_SIZE,
+		    ye = y + TILE_SIZE > cy + fh ? cy + fh : y + TILE_SIZE;
+
+		x0 = x < x0 ? x : x0;
+		y0 = y < y0 ? y : y0;
+		x1 = xe > x1 ? xe : x1;
+		y1 = ye > y1 ? ye : y1;
+	}
+	if (x1 <= x0)
+		return false;
+
+	rect[0] = x0;
+	rect[1] = y0;
+	rect[2] = x1 - x0;
+	rect[3] = y1 - y0;
+
+	return true;
+}
+
+//
+// Serialize `n` tile references to a buffer of `*len` bytes: a table of
+// `n` indices into the distinct tiles that follow, where 0 stands for the
+// blank tile, then the pixels of those tiles. Tiles referenced several
+// times are only written once.
+//
+uint8_t *tilesPack(struct tile **tiles, int n, size_t *len)
+{
+	struct tile *blank = tileBlank();
+	size_t cap = 64;
+	int k = 0;
+
+	while (cap < (size_t)n * 2)
+		cap *= 2;
+
+	// Open addressing on the tile address, since tiles are interned.
+	struct { struct tile *t; uint32_t i; } *seen = calloc(cap, sizeof(*seen));
+	uint32_t *index = malloc(n * sizeof(*index));
+	struct tile **order = malloc(n * sizeof(*order));
+
+	for (int i = 0; i < n; i++) {
+		if (tiles[i] == blank) {
+			index[i] = 0;
+			continue;
+		}
+		size_t h = (tiles[i]->hash ^ (uintptr_t)tiles[i]) & (cap - 1);
+
+		while (seen[h].t && seen[h].t != tiles[i])
+			h = (h + 1) & (cap - 1);
+
+		if (!seen[h].t) {
+			seen[h].t = tiles[i];
+			seen[h].i = ++k;
+			order[k - 1] = tiles[i];
+		}
+		index[i] = seen[h].i;
+	}
+	*len = 2 * sizeof(uint32_t) + n * sizeof(*index) + (size_t)k * sizeof(blank->pixels);
+
+	uint8_t *buf = malloc(*len), *p = buf;
+	uint32_t header[2] = { n, k };
+
+	memcpy(p, header, sizeof(header));
+	p += sizeof(header);
+	memcpy(p, index, n * sizeof(*index));
+	p += n * sizeof(*index);
+
+	for (int i = 0; i < k; i++, p += sizeof(blank->pixels)) {
+		memcpy(p, order[i]->pixels, sizeof(blank->pixels));
+	}
+	free(seen);
+	free(index);
+	free(order);
+	tileRelease(blank);
+
+	return buf;
+}
+
+//
+// Turn a buffer written by `tilesPack` back into `n` tile references, which
+// the caller owns. Tiles still in the store are shared again. Returns NULL
+// if the buffer doesn't hold `n` tiles.
+//
+struct tile **tilesUnpack(const uint8_t *buf, size_t len, int n)
+{
+	uint32_t header[2];
+
+	if (len < sizeof(header))
+		return NULL;
+
+	memcpy(header, buf, sizeof(header));
+
+	size_t px = sizeof(((struct tile *)0)->pixels);
+
+	if (header[0] != (uint32_t)n || len != sizeof(header) + n * sizeof(uint32_t) + header[1] * px)
+		return NULL;
+
+	const uint8_t *index = buf + sizeof(header),
+	              *pixels = index + n * sizeof(uint32_t);
+	struct tile **uniq = malloc((header[1] + 1) * sizeof(*uniq)),
+	            **tiles = malloc(n * sizeof(*tiles));
+
+	uniq[0] = tileBlank();
+
+	for (uint32_t i = 0; i < header[1]; i++) {
+		struct rgba tile[TILE_PIXELS];
+
+		memcpy(tile, pixels + i * px, px);
+		uniq[i + 1] = tileIntern(tile, TILE_SIZE, TILE_SIZE, TILE_SIZE);
+	}
+	for (int i = 0; i < n; i++) {
+		uint32_t j;
+
+		memcpy(&j, index + i * sizeof(j), sizeof(j));
+
+		if (j > header[1]) {
+			tilesRelease(tiles, i);
+			tiles = NULL;
+			break;
+		}
+		tiles[i] = uniq[j];
+		tileRetain(tiles[i]);
+	}
+	for (uint32_t i = 0; i <= header[1]; i++) {
+		tileRelease(uniq[i]);
+	}
+	free(uniq);
+
+	return tiles;
+}
@@ -0,0 +1,36 @@
+//
+// tiles.h
+// content-addressed tile store
+//
+#define TILE_SIZE 16
+
+struct tile {
+	uint64_t    hash;
+	int         refs;
+	uint32_t    saved; // Number of the tile in the history file plus one, or 0
+	struct tile *next; // Next tile in the same hash bucket
+	struct rgba pixels[TILE_SIZE * TILE_SIZE];
+};
+
+struct tilestats {
+	size_t unique;  // Tiles held in the store
+	size_t refs;    // References to those tiles
+	size_t bytes;   // Memory used by the tiles
+	size_t logical; // Memory the references would use without sharing
+};
+
+struct tile     *tileIntern(const struct rgba *, int, int, int);
+struct tile     *tileBlank(void);
+void             tileRetain(struct tile *);
+void             tileRelease(struct tile *);
+struct tilestats tileStats(void);
+void             tilesRenumber(const uint32_t *, uint32_t);
+
+int           tilesPerFrame(int, int);
+struct tile **tilesFromPixels(const struct rgba *, int, int, int, int, int *);
+void          tilesToPixels(struct tile **, struct rgba *, int, int, int, int);
+void          tilesReadRect(struct tile **, int, int, int, int, const int *, struct rgba *);
+void          tilesRelease(struct tile **, int);
+bool          tilesDiff(struct tile **, int, struct tile **, int, int, int, int, int, int *);
+uint8_t      *tilesPack(struct tile **, int, size_t *);
+struct tile **tilesUnpack(const uint8_t *, size_t, int);
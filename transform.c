@@ -0,0 +1,296 @@
+//
+// transform.c
+// pixel transforms
+//
+// Transforms read a `w * h` image and write a new one, a band of output
+// rows at a time, so that large images can be split across threads. All
+// kernels walk the output in row order; rotation reads the source in
+// square blocks, so that both sides stay in cache.
+//
+#define _POSIX_C_SOURCE 200809L
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "color.h"
+#include "transform.h"
+
+#define BLOCK 16        // Side of the blocks rotation works in
+#define BAND  64        // Output rows per job
+#define MAX_THREADS 16
+
+static inline bool eq(struct rgba a, struct rgba b)
+{
+	return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+//
+// Return the source pixel at `x, y`, with coordinates clamped to the image,
+// so that edges repeat.
+//
+static inline struct rgba at(const struct rgba *src, int w, int h, int x, int y)
+{
+	x = x < 0 ? 0 : x >= w ? w - 1 : x;
+	y = y < 0 ? 0 : y >= h ? h - 1 : y;
+
+	return src[y * w + x];
+}
+
+void transformSize(enum transform t, int w, int h, int *ow, int *oh)
+{
+	switch (t) {
+	case TRANSFORM_ROTATE_CW:
+	case TRANSFORM_ROTATE_CCW:
+		*ow = h;
+		*oh = w;
+		break;
+	case TRANSFORM_SCALE_2:
+	case TRANSFORM_SCALE2X:
+		*ow = w * 2;
+		*oh = h * 2;
+		break;
+	case TRANSFORM_SCALE_3:
+	case TRANSFORM_SCALE3X:
+		*ow = w * 3;
+		*oh = h * 3;
+		break;
+	default:
+		*ow = w;
+		*oh = h;
+		break;
+	}
+}
+
+static void rotateRows(const struct rgba *src, int w, int h, struct rgba *dst, int y0, int y1, bool cw)
+{
+	int ow = h;
+
+	for (int by = y0; by < y1; by += BLOCK) {
+		for (int bx = 0; bx < ow; bx += BLOCK) {
+			int ey = by + BLOCK < y1 ? by + BLOCK : y1,
+			    ex = bx + BLOCK < ow ? bx + BLOCK : ow;
+
+			for (int y = by; y < ey; y++) {
+				for (int x = bx; x < ex; x++) {
+					dst[y * ow + x] = cw ? src[(h - 1 - x) * w + y] : src[x * w + (w - 1 - y)];
+				}
+			}
+		}
+	}
+}
+
+//
+// Scale2x, also known as AdvMAME2x: each pixel becomes four, which take
+// the color of a neighbour where two neighbours agree along an edge. It
+// gives the same results as EPX.
+//
+static void scale2xRows(const struct rgba *src, int w, int h, struct rgba *dst, int y0, int y1)
+{
+	for (int y = y0; y < y1; y++) {
+		int sy = y / 2;
+		bool top = y % 2 == 0;
+
+		for (int sx = 0; sx < w; sx++) {
+			struct rgba B = at(src, w, h, sx, sy - 1),
+			            D = at(src, w, h, sx - 1, sy),
+			            E = src[sy * w + sx],
+			            F = at(src, w, h, sx + 1, sy),
+			            H = at(src, w, h, sx, sy + 1);
+			struct rgba *out = &dst[y * w * 2 + sx * 2];
+
+			if (eq(B, H) || eq(D, F)) {
+				out[0] = out[1] = E;
+			} else if (top) {
+				out[0] = eq(D, B) ? D : E;
+				out[1] = eq(B, F) ? F : E;
+			} else {
+				out[0] = eq(D, H) ? D : E;
+				out[1] = eq(H, F) ? F : E;
+			}
+		}
+	}
+}
+
+//
+// Scale3x, also known as AdvMAME3x: the same idea as Scale2x, on a 3x3 grid.
+//
+static void scale3xRows(const struct rgba *src, int w, int h, struct rgba *dst, int y0, int y1)
+{
+	for (int y = y0; y < y1; y++) {
+		int sy = y / 3, row = y % 3;
+
+		for (int sx = 0; sx < w; sx++) {
+			struct rgba A = at(src, w, h, sx - 1, sy - 1),
+			            B = at(src, w, h, sx, sy - 1),
+			            C = at(src, w, h, sx + 1, sy - 1),
+			            D = at(src, w, h, sx - 1, sy),
+			            E = src[sy * w + sx],
+			            F = at(src, w, h, sx + 1, sy),
+			            G = at(src, w, h, sx - 1, sy + 1),
+			            H = at(src, w, h, sx, sy + 1),
+			            I = at(src, w, h, sx + 1, sy + 1);
+			struct rgba *out = &dst[y * w * 3 + sx * 3];
+
+			out[0] = out[1] = out[2] = E;
+
+			if (eq(B, H) || eq(D, F))
+				continue;
+
+			bool db = eq(D, B), bf = eq(B, F), dh = eq(D, H), hf = eq(H, F);
+
+			switch (row) {
+			case 0:
+				out[0] = db ? D : E;
+				out[1] = (db && !eq(E, C)) || (bf && !eq(E, A)) ? B : E;
+				out[2] = bf ? F : E;
+				break;
+			case 1:
+				out[0] = (db && !eq(E, G)) || (dh && !eq(E, A)) ? D : E;
+				out[2] = (bf && !eq(E, I)) || (hf && !eq(E, C)) ? F : E;
+				break;
+			case 2:
+				out[0] = dh ? D : E;
+				out[1] = (dh && !eq(E, I)) || (hf && !eq(E, G)) ? H : E;
+				out[2] = hf ? F : E;
+				break;
+			}
+		}
+	}
+}
+
+//
+// Write output rows `y0` to `y1` of the transform of `src` to `dst`.
+//
+void transformRows(enum transform t, const struct rgba *src, int w, int h, struct rgba *dst, int y0, int y1)
+{
+	switch (t) {
+	case TRANSFORM_FLIP_H:
+		for (int y = y0; y < y1; y++) {
+			for (int x = 0; x < w; x++) {
+				dst[y * w + x] = src[y * w + w - 1 - x];
+			}
+		}
+		break;
+	case TRANSFORM_FLIP_V:
+		for (int y = y0; y < y1; y++) {
+			memcpy(&dst[y * w], &src[(h - 1 - y) * w], w * sizeof(*dst));
+		}
+		break;
+	case TRANSFORM_ROTATE_CW:
+	case TRANSFORM_ROTATE_CCW:
+		rotateRows(src, w, h, dst, y0, y1, t == TRANSFORM_ROTATE_CW);
+		break;
+	case TRANSFORM_SCALE_2:
+	case TRANSFORM_SCALE_3: {
+			int k = t == TRANSFORM_SCALE_2 ? 2 : 3;
+
+			for (int y = y0; y < y1; y++) {
+				const struct rgba *row = &src[(y / k) * w];
+
+				if (y % k && y > y0) { // Same as the row above
+					memcpy(&dst[y * w * k], &dst[(y - 1) * w * k], w * k * sizeof(*dst));
+					continue;
+				}
+				for (int x = 0; x < w * k; x++) {
+					dst[y * w * k + x] = row[x / k];
+				}
+			}
+		}
+		break;
+	case TRANSFORM_SCALE2X:
+		scale2xRows(src, w, h, dst, y0, y1);
+		break;
+	case TRANSFORM_SCALE3X:
+		scale3xRows(src, w, h, dst, y0, y1);
+		break;
+	}
+}
+
+void transformPixels(enum transform t, const struct rgba *src, int w, int h, struct rgba *dst)
+{
+	int ow, oh;
+
+	transformSize(t, w, h, &ow, &oh);
+	transformRows(t, src, w, h, dst, 0, oh);
+}
+
+struct jobs {
+	enum transform    t;
+	const struct rgba **src;
+	struct rgba       **dst;
+	int               w, h;
+	int               bands; // Bands per page
+	int               njobs;
+	int               next;
+	pthread_mutex_t   lock;
+};
+
+static void *worker(void *arg)
+{
+	struct jobs *j = arg;
+	int ow, oh;
+
+	transformSize(j->t, j->w, j->h, &ow, &oh);
+
+	for (;;) {
+		pthread_mutex_lock(&j->lock);
+		int job = j->next++;
+		pthread_mutex_unlock(&j->lock);
+
+		if (job >= j->njobs)
+			return NULL;
+
+		int page = job / j->bands,
+		    y0   = (job % j->bands) * BAND,
+		    y1   = y0 + BAND < oh ? y0 + BAND : oh;
+
+		transformRows(j->t, j->src[page], j->w, j->h, j->dst[page], y0, y1);
+	}
+}
+
+//
+// Transform `n` images of `w * h` pixels, splitting the work in bands of
+// rows across threads.
+//
+void transformPages(enum transform t, const struct rgba **src, struct rgba **dst, int n, int w, int h)
+{
+	int ow, oh;
+
+	transformSize(t, w, h, &ow, &oh);
+
+	struct jobs j = {
+		.t     = t,
+		.src   = src,
+		.dst   = dst,
+		.w     = w,
+		.h     = h,
+		.bands = (oh + BAND - 1) / BAND,
+		.next  = 0
+	};
+	j.njobs = n * j.bands;
+
+	long ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int nthreads = ncpus < 1 ? 1 : ncpus > MAX_THREADS ? MAX_THREADS : ncpus;
+	pthread_t threads[MAX_THREADS];
+
+	if (nthreads > j.njobs)
+		nthreads = j.njobs;
+
+	pthread_mutex_init(&j.lock, NULL);
+
+	// The calling thread is one of the workers.
+	for (int i = 1; i < nthreads; i++) {
+		if (pthread_create(&threads[i], NULL, worker, &j) != 0)
+			nthreads = i;
+	}
+	worker(&j);
+
+	for (int i = 1; i < nthreads; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	pthread_mutex_destroy(&j.lock);
+}
@@ -0,0 +1,19 @@
+//
+// transform.h
+// pixel transforms
+//
+enum transform {
+	TRANSFORM_FLIP_H,
+	TRANSFORM_FLIP_V,
+	TRANSFORM_ROTATE_CW,
+	TRANSFORM_ROTATE_CCW,
+	TRANSFORM_SCALE_2,  // Nearest neighbour
+	TRANSFORM_SCALE_3,
+	TRANSFORM_SCALE2X,  // Same as EPX
+	TRANSFORM_SCALE3X
+};
+
+void transformSize(enum transform, int, int, int *, int *);
+void transformRows(enum transform, const struct rgba *, int, int, struct rgba *, int, int);
+void transformPixels(enum transform, const struct rgba *, int, int, struct rgba *);
+void transformPages(enum transform, const struct rgba **, struct rgba **, int, int, int);